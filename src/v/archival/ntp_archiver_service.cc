@@ -17,11 +17,13 @@
 #include "archival/scrubber.h"
 #include "archival/segment_reupload.h"
 #include "archival/types.h"
+#include "bytes/iostream.h"
 #include "cloud_storage/async_manifest_view.h"
 #include "cloud_storage/partition_manifest.h"
 #include "cloud_storage/remote.h"
 #include "cloud_storage/remote_segment.h"
 #include "cloud_storage/remote_segment_index.h"
+#include "cloud_storage/segment_compression.h"
 #include "cloud_storage/spillover_manifest.h"
 #include "cloud_storage/topic_manifest.h"
 #include "cloud_storage/tx_range_manifest.h"
@@ -207,6 +209,8 @@ ntp_archiver::ntp_archiver(
   , _manifest_upload_interval(
       config::shard_local_cfg()
         .cloud_storage_manifest_max_upload_interval_sec.bind())
+  , _manifest_delta_segments(
+      config::shard_local_cfg().cloud_storage_manifest_delta_segments.bind())
   , _manifest_view(std::move(amv)) {
     _housekeeping_interval.watch([this] {
         _housekeeping_jitter = simple_time_jitter<ss::lowres_clock>{
@@ -548,6 +552,10 @@ ss::future<> ntp_archiver::upload_until_term_change() {
         }
     }
 
+    // Another leader may have uploaded the manifest since this node last
+    // did, start over from a full upload.
+    _manifest_delta_base.reset();
+
     // Before starting, upload the manifest if needed.  This makes our
     // behavior more deterministic on first start (uploading the empty
     // manifest) and after unclean leadership changes (flush dirty manifest
@@ -993,15 +1001,58 @@ ss::future<cloud_storage::upload_result> ntp_archiver::upload_manifest(
 
     auto upload_insync_offset = manifest().get_insync_offset();
 
-    vlog(
-      _rtclog.debug,
-      "[{}] Uploading partition manifest, insync_offset={}, path={}",
-      upload_ctx,
-      upload_insync_offset,
-      manifest().get_manifest_path());
+    std::optional<cloud_storage::partition_manifest_delta> delta;
+    if (_manifest_delta_segments() > 0 && _manifest_delta_base.has_value()) {
+        delta = cloud_storage::partition_manifest_delta::make(
+          manifest(), *_manifest_delta_base);
+        if (delta.has_value() && delta->size() > _manifest_delta_segments()) {
+            // Compact the delta into a new base
+            delta.reset();
+        }
+    }
+
+    cloud_storage::upload_result result;
+    if (delta.has_value()) {
+        vlog(
+          _rtclog.debug,
+          "[{}] Uploading partition manifest delta, insync_offset={}, "
+          "segments={}, base={}, path={}",
+          upload_ctx,
+          upload_insync_offset,
+          delta->size(),
+          delta->base(),
+          delta->get_manifest_path());
 
-    auto result = co_await _remote.upload_manifest(
-      get_bucket_name(), manifest(), fib);
+        result = co_await _remote.upload_manifest(
+          get_bucket_name(), *delta, fib);
+    } else {
+        vlog(
+          _rtclog.debug,
+          "[{}] Uploading partition manifest, insync_offset={}, path={}",
+          upload_ctx,
+          upload_insync_offset,
+          manifest().get_manifest_path());
+
+        // Until the upload is known to have succeeded, the bucket may hold
+        // either the old or the new manifest.
+        _manifest_delta_base.reset();
+        if (_manifest_delta_segments() > 0) {
+            // The manifest may change while it is being uploaded. Upload a
+            // snapshot, so that deltas are made against exactly what readers
+            // will find in the bucket.
+            auto snapshot = manifest().clone();
+            auto base = cloud_storage::partition_manifest_delta_base::from(
+              snapshot);
+            result = co_await _remote.upload_manifest(
+              get_bucket_name(), snapshot, fib);
+            if (result == cloud_storage::upload_result::success) {
+                _manifest_delta_base = base;
+            }
+        } else {
+            result = co_await _remote.upload_manifest(
+              get_bucket_name(), manifest(), fib);
+        }
+    }
 
     if (result == cloud_storage::upload_result::success) {
         _last_manifest_upload_time = ss::lowres_clock::now();
@@ -1042,6 +1093,9 @@ remote_segment_path ntp_archiver::segment_path_for_candidate(
     return manifest().generate_segment_path(val);
 }
 
+// Read the upload candidate once, and hand the same buffers to both the
+// upload and the remote segment index builder. The index doesn't cost a
+// second read of the segment from disk, only a parse of the batch headers.
 static std::pair<ss::input_stream<char>, ss::input_stream<char>>
 split_segment_stream(
   upload_candidate candidate, ss::io_priority_class priority) {
@@ -1152,6 +1206,20 @@ ss::future<cloud_storage::upload_result> ntp_archiver::do_upload_segment(
     co_return response;
 }
 
+cloud_storage::segment_name_format
+ntp_archiver::upload_format(const upload_candidate& candidate) const {
+    // Older nodes can't generate the name of a v4 segment, the format is
+    // only written once all of them understand it.
+    if (
+      candidate.content_length
+        < config::shard_local_cfg().cloud_storage_segment_index_min_size()
+      && _feature_table.local().is_active(
+        features::feature::cloud_storage_unindexed_segments)) {
+        return cloud_storage::segment_name_format::v4;
+    }
+    return cloud_storage::segment_name_format::v3;
+}
+
 static ss::sstring make_index_path(const remote_segment_path& segment_path) {
     return fmt::format("{}.index", segment_path().native());
 }
@@ -1160,17 +1228,27 @@ static ss::sstring make_index_path(const remote_segment_path& segment_path) {
 ss::future<ntp_archiver_upload_result> ntp_archiver::upload_segment(
   model::term_id archiver_term,
   upload_candidate candidate,
+  cloud_storage::segment_name_format sname_format,
   std::vector<ss::rwlock::holder> segment_read_locks,
   std::optional<std::reference_wrapper<retry_chain_node>> source_rtc) {
     vassert(
       candidate.remote_sources.empty(),
       "This method can only work with local segments");
 
+    auto path = segment_path_for_candidate(archiver_term, candidate);
+    const bool upload_index = sname_format
+                              != cloud_storage::segment_name_format::v4;
+
+    if (
+      !upload_index
+      && config::shard_local_cfg().cloud_storage_compress_small_segments()) {
+        co_return co_await upload_compressed_segment(
+          path, std::move(candidate), source_rtc);
+    }
+
     auto [stream_upload, stream_index] = split_segment_stream(
       candidate, _conf->upload_io_priority);
 
-    auto path = segment_path_for_candidate(archiver_term, candidate);
-
     auto upload_fut = do_upload_segment(
       path, candidate, std::move(stream_upload), source_rtc);
 
@@ -1186,6 +1264,18 @@ ss::future<ntp_archiver_upload_result> ntp_archiver::upload_segment(
       std::move(upload_fut), std::move(make_idx_fut));
 
     if (
+      upload_res == cloud_storage::upload_result::success
+      && idx_res.has_value() && !upload_index) {
+        // Readers download v4 segments whole and index them locally, the
+        // index object would only add a PUT per segment.
+        vlog(
+          _rtclog.debug,
+          "skipping segment index upload to {}, segment size {} is below "
+          "cloud_storage_segment_index_min_size",
+          index_path,
+          candidate.content_length);
+        co_return ntp_archiver_upload_result(idx_res->stats);
+    } else if (
       upload_res == cloud_storage::upload_result::success
       && idx_res.has_value()) {
         auto rtc = source_rtc.value_or(std::ref(_rtcnode));
@@ -1247,6 +1337,66 @@ ss::future<ntp_archiver_upload_result> ntp_archiver::upload_segment(
     // manifest.
 }
 
+ss::future<ntp_archiver_upload_result> ntp_archiver::upload_compressed_segment(
+  const remote_segment_path& path,
+  upload_candidate candidate,
+  std::optional<std::reference_wrapper<retry_chain_node>> source_rtc) {
+    auto rtc = source_rtc.value_or(std::ref(_rtcnode));
+    retry_chain_node fib(
+      _conf->segment_upload_timeout,
+      _conf->cloud_storage_initial_backoff,
+      &rtc.get());
+    retry_chain_logger ctxlog(archival_log, fib, _ntp.path());
+
+    auto streams = split_segment_stream(candidate, _conf->upload_io_priority);
+
+    // The stats are needed for the upload consistency checks, the index
+    // itself is dropped since small segments are downloaded whole.
+    auto read_fut = read_iobuf_exactly(streams.first, candidate.content_length)
+                      .finally([&streams] { return streams.first.close(); });
+    auto make_idx_fut = make_segment_index(
+      candidate.starting_offset,
+      candidate.base_timestamp,
+      ctxlog,
+      path().native(),
+      std::move(streams.second));
+    auto [segment, idx_res] = co_await ss::when_all_succeed(
+      std::move(read_fut), std::move(make_idx_fut));
+    if (segment.size_bytes() != candidate.content_length) {
+        vlog(
+          ctxlog.error,
+          "segment {} is truncated, read {} bytes",
+          candidate,
+          segment.size_bytes());
+        co_return cloud_storage::upload_result::failed;
+    }
+    if (!idx_res.has_value()) {
+        co_return cloud_storage::upload_result::failed;
+    }
+
+    // Segments of producer compressed batches don't compress any further,
+    // those are uploaded as is
+    auto object = co_await cloud_storage::maybe_compress_segment(
+      std::move(segment));
+    vlog(
+      ctxlog.debug,
+      "Uploading segment {} to {}, {} bytes, {} bytes uploaded",
+      candidate,
+      path,
+      candidate.content_length,
+      object.size_bytes());
+    auto res = co_await _remote.upload_object(
+      get_bucket_name(),
+      cloud_storage_clients::object_key{path()},
+      std::move(object),
+      fib,
+      "segment");
+    if (res != cloud_storage::upload_result::success) {
+        co_return res;
+    }
+    co_return ntp_archiver_upload_result(idx_res->stats);
+}
+
 std::optional<ss::sstring> ntp_archiver::upload_should_abort() {
     auto original_term = _parent.term();
     auto lost_leadership = !_parent.is_leader()
@@ -1448,8 +1598,9 @@ ntp_archiver::schedule_single_upload(const upload_context& upload_ctx) {
     // uploaded.
     std::vector<ss::future<ntp_archiver_upload_result>> all_uploads;
 
-    all_uploads.emplace_back(
-      upload_segment(upload_ctx.archiver_term, upload, std::move(locks)));
+    const auto sname_format = upload_format(upload);
+    all_uploads.emplace_back(upload_segment(
+      upload_ctx.archiver_term, upload, sname_format, std::move(locks)));
 
     ss::log_level level{};
     std::exception_ptr ep;
@@ -1504,7 +1655,7 @@ ntp_archiver::schedule_single_upload(const upload_context& upload_ctx) {
         .archiver_term = upload_ctx.archiver_term,
         .segment_term = upload.term,
         .delta_offset_end = delta_offset_next,
-        .sname_format = cloud_storage::segment_name_format::v3,
+        .sname_format = sname_format,
         .metadata_size_hint = tx_size,
       },
       .name = upload.exposed_name, .delta = offset - base,
@@ -2225,13 +2376,17 @@ ss::future<> ntp_archiver::garbage_collect_archive() {
                       // Add index and tx-manifest
                       if (
                         meta.sname_format
-                          == cloud_storage::segment_name_format::v3
+                          >= cloud_storage::segment_name_format::v3
                         && meta.metadata_size_hint != 0) {
                           objects_to_remove.push_back(
                             cloud_storage::generate_remote_tx_path(path)());
                       }
-                      objects_to_remove.push_back(
-                        cloud_storage::generate_index_path(path));
+                      if (
+                        meta.sname_format
+                        != cloud_storage::segment_name_format::v4) {
+                          objects_to_remove.push_back(
+                            cloud_storage::generate_index_path(path));
+                      }
                   } else {
                       // This indicates that we need to remove only some of the
                       // segments from the manifest. In this case the outer loop
@@ -2884,8 +3039,9 @@ ss::future<bool> ntp_archiver::do_upload_local(
 
     // Upload segments and tx-manifest in parallel
     std::vector<ss::future<ntp_archiver_upload_result>> futures;
-    futures.emplace_back(
-      upload_segment(archiver_term, upload, std::move(locks), source_rtc));
+    const auto sname_format = upload_format(upload);
+    futures.emplace_back(upload_segment(
+      archiver_term, upload, sname_format, std::move(locks), source_rtc));
 
     size_t tx_size = 0;
     std::exception_ptr tx_ep;
@@ -2932,7 +3088,7 @@ ss::future<bool> ntp_archiver::do_upload_local(
       .archiver_term = archiver_term,
       .segment_term = upload.term,
       .delta_offset_end = delta_offset_next,
-      .sname_format = cloud_storage::segment_name_format::v3,
+      .sname_format = sname_format,
       .metadata_size_hint = tx_size,
     };
 
@@ -15,6 +15,7 @@
 #include "cloud_storage/cache_service.h"
 #include "cloud_storage/fwd.h"
 #include "cloud_storage/partition_manifest.h"
+#include "cloud_storage/partition_manifest_delta.h"
 #include "cloud_storage/remote.h"
 #include "cloud_storage/remote_segment_index.h"
 #include "cloud_storage/types.h"
@@ -444,6 +445,8 @@ private:
     ///
     /// \param archiver_term is a current term of the archiver
     /// \param candidate is an upload candidate
+    /// \param sname_format is the format recorded for the segment in the
+    ///        manifest, v4 segments are uploaded without an index
     /// \param segment_read_locks protects the underlying segment(s) from being
     ///        deleted while the upload is in flight.
     /// \param stream is a stream to the segment used for the initial upload. If
@@ -455,6 +458,7 @@ private:
     ss::future<ntp_archiver_upload_result> upload_segment(
       model::term_id archiver_term,
       upload_candidate candidate,
+      cloud_storage::segment_name_format sname_format,
       std::vector<ss::rwlock::holder> segment_read_locks,
       std::optional<std::reference_wrapper<retry_chain_node>> source_rtc
       = std::nullopt);
@@ -469,6 +473,18 @@ private:
       std::optional<std::reference_wrapper<retry_chain_node>> source_rtc
       = std::nullopt);
 
+    /// Segments below cloud_storage_segment_index_min_size are uploaded
+    /// without an index once the whole cluster can read them that way.
+    cloud_storage::segment_name_format
+    upload_format(const upload_candidate& candidate) const;
+
+    /// Upload a small segment as a compressed object, without an index. The
+    /// segment is read into memory once, to compute its stats and compress it.
+    ss::future<ntp_archiver_upload_result> upload_compressed_segment(
+      const remote_segment_path& path,
+      upload_candidate candidate,
+      std::optional<std::reference_wrapper<retry_chain_node>> source_rtc);
+
     /// Get aborted transactions for upload
     ///
     /// \return list of aborted transactions
@@ -661,6 +677,12 @@ private:
     config::binding<std::optional<std::chrono::seconds>>
       _manifest_upload_interval;
 
+    // The last full manifest uploaded in the current term. While the manifest
+    // only grows by appended segments, uploads write a delta against it.
+    std::optional<cloud_storage::partition_manifest_delta_base>
+      _manifest_delta_base;
+    config::binding<size_t> _manifest_delta_segments;
+
     ss::shared_ptr<cloud_storage::async_manifest_view> _manifest_view;
 
     friend class archival_fixture;
@@ -28,6 +28,7 @@
 namespace {
 static constexpr std::string_view serde_extension = ".bin";
 static constexpr std::string_view json_extension = ".json";
+static constexpr std::string_view delta_extension = ".delta";
 
 static constexpr auto partition_purge_timeout = 20s;
 } // namespace
@@ -159,6 +160,28 @@ ss::future<purger::purge_result> purger::purge_partition(
         }
     }
 
+    // The segments of the delta were erased with the manifest it applies to
+    if (collected->delta) {
+        vlog(
+          ctxlog.debug,
+          "Erasing partition manifest delta {}",
+          *collected->delta);
+        const auto delta_delete_result = co_await _api.delete_object(
+          bucket,
+          cloud_storage_clients::object_key(*collected->delta),
+          partition_purge_rtc);
+        if (delta_delete_result != upload_result::success) {
+            vlog(
+              ctxlog.info,
+              "Retryable failures encountered while purging partition "
+              "manifest delta at {}. Will retry ...",
+              collected->delta.value());
+
+            co_return purge_result{
+              .status = purge_status::retryable_failure, .ops = ops_performed};
+        }
+    }
+
     if (permanent_failure > 0) {
         vlog(
           ctxlog.error,
@@ -229,6 +252,11 @@ purger::collect_manifest_paths(
             continue;
         }
 
+        if (path.ends_with(delta_extension)) {
+            collected.delta = std::move(item.key);
+            continue;
+        }
+
         collected.spillover.push_back(std::move(item.key));
     }
 
@@ -271,6 +299,26 @@ ss::future<purger::purge_result> purger::purge_manifest(
         co_return result;
     }
 
+    if (
+      format == cloud_storage::manifest_format::serde
+      && manifest_key == manifest.get_manifest_path()) {
+        // Segments uploaded since the last full upload of the manifest are
+        // only listed in its delta object
+        auto delta_result = co_await _api.try_apply_partition_manifest_delta(
+          bucket, manifest, manifest_purge_rtc);
+        if (
+          delta_result == download_result::failed
+          || delta_result == download_result::timedout) {
+            vlog(
+              ctxlog.debug,
+              "Partition manifest delta get for {} failed: {}",
+              manifest_key(),
+              delta_result);
+            result.status = purge_status::retryable_failure;
+            co_return result;
+        }
+    }
+
     // A rough guess at how many ops will be involved in deletion, so that
     // we don't have to plumb ops-counting all the way down into object store
     // clients' implementations of plural object delete (different
@@ -572,7 +620,7 @@ ss::sstring purger::name() const { return "purger"; }
 
 bool purger::collected_manifests::empty() const {
     return !current_serde.has_value() && !current_json.has_value()
-           && spillover.empty();
+           && spillover.empty() && !delta.has_value();
 }
 
 purger::collected_manifests::flat_t purger::collected_manifests::flatten() {
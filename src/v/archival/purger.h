@@ -83,6 +83,7 @@ private:
         std::optional<ss::sstring> current_serde;
         std::optional<ss::sstring> current_json;
         std::vector<ss::sstring> spillover;
+        std::optional<ss::sstring> delta;
 
         bool empty() const;
         [[nodiscard]] flat_t flatten();
@@ -476,6 +476,8 @@ segment_name partition_manifest::generate_remote_segment_name(
     case segment_name_format::v2:
         [[fallthrough]];
     case segment_name_format::v3:
+        [[fallthrough]];
+    case segment_name_format::v4:
         // Use new style format ".../base-committed-term-size-v1.log"
         return segment_name(ssx::sformat(
           "{}-{}-{}-{}-v1.log",
@@ -2247,7 +2249,7 @@ void partition_manifest::serialize_segment_meta(
         w.Key("sname_format");
         w.Int64(static_cast<int16_t>(meta.sname_format));
     }
-    if (meta.sname_format == segment_name_format::v3) {
+    if (meta.sname_format >= segment_name_format::v3) {
         w.Key("metadata_size_hint");
         w.Int64(static_cast<int64_t>(meta.metadata_size_hint));
     }
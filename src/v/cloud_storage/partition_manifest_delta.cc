@@ -0,0 +1,171 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Licensed as a Redpanda Enterprise file under the Redpanda Community
+ * License (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ * https://github.com/redpanda-data/redpanda/blob/master/licenses/rcl.md
+ */
+
+#include "cloud_storage/partition_manifest_delta.h"
+
+#include "bytes/iobuf.h"
+#include "bytes/iostream.h"
+#include "hashing/xx.h"
+#include "serde/serde.h"
+
+#include <seastar/core/coroutine.hh>
+#include <seastar/core/iostream.hh>
+
+#include <fmt/ostream.h>
+
+namespace cloud_storage {
+
+remote_manifest_path generate_partition_manifest_delta_path(
+  const model::ntp& ntp, model::initial_revision_id rev) {
+    auto path = generate_partition_manifest_path(
+      ntp, rev, manifest_format::serde);
+    return remote_manifest_path(fmt::format("{}.delta", path().string()));
+}
+
+partition_manifest_delta_base
+partition_manifest_delta_base::from(const partition_manifest& m) {
+    incremental_xxhash64 h;
+    h.update_all(
+      m.get_start_offset().value_or(model::offset{}),
+      m.get_start_kafka_offset_override(),
+      m.get_archive_start_offset(),
+      m.get_archive_start_offset_delta(),
+      m.get_archive_clean_offset(),
+      m.get_spillover_map().size());
+    for (const auto& s : m.lw_replaced_segments()) {
+        h.update_all(
+          s.base_offset, s.committed_offset, s.segment_term, s.size_bytes);
+    }
+    return {
+      .insync_offset = m.get_insync_offset(),
+      .last_offset = m.get_last_offset(),
+      .fingerprint = h.digest(),
+    };
+}
+
+std::ostream&
+operator<<(std::ostream& o, const partition_manifest_delta_base& b) {
+    fmt::print(
+      o,
+      "{{insync_offset: {}, last_offset: {}, fingerprint: {}}}",
+      b.insync_offset,
+      b.last_offset,
+      b.fingerprint);
+    return o;
+}
+
+namespace {
+
+struct partition_manifest_delta_serde
+  : serde::envelope<
+      partition_manifest_delta_serde,
+      serde::version<0>,
+      serde::compat_version<0>> {
+    model::ntp ntp;
+    model::initial_revision_id rev;
+    partition_manifest_delta_base base;
+    model::offset insync_offset;
+    fragmented_vector<segment_meta> segments;
+};
+
+} // namespace
+
+partition_manifest_delta::partition_manifest_delta(
+  model::ntp ntp, model::initial_revision_id rev)
+  : _ntp(std::move(ntp))
+  , _rev(rev) {}
+
+std::optional<partition_manifest_delta> partition_manifest_delta::make(
+  const partition_manifest& m, const partition_manifest_delta_base& base) {
+    auto current = partition_manifest_delta_base::from(m);
+    if (
+      current.fingerprint != base.fingerprint
+      || current.insync_offset < base.insync_offset
+      || current.last_offset < base.last_offset) {
+        return std::nullopt;
+    }
+
+    partition_manifest_delta delta(m.get_ntp(), m.get_revision_id());
+    delta._base = base;
+    delta._insync_offset = current.insync_offset;
+    if (current.last_offset == base.last_offset) {
+        return delta;
+    }
+
+    // The base must end on a segment boundary that is still there, otherwise
+    // a segment was merged across it.
+    auto last = m.segment_containing(base.last_offset);
+    if (last == m.end() || last->committed_offset != base.last_offset) {
+        return std::nullopt;
+    }
+    for (auto it = m.segment_containing(model::next_offset(base.last_offset));
+         it != m.end();
+         ++it) {
+        delta._segments.push_back(*it);
+    }
+    return delta;
+}
+
+bool partition_manifest_delta::apply(partition_manifest& m) const {
+    if (
+      m.get_ntp() != _ntp || m.get_revision_id() != _rev
+      || partition_manifest_delta_base::from(m) != _base) {
+        return false;
+    }
+    // Check that the segments extend the base before adding any of them
+    auto next = model::next_offset(m.get_last_offset());
+    for (const auto& s : _segments) {
+        if (s.base_offset != next) {
+            return false;
+        }
+        next = model::next_offset(s.committed_offset);
+    }
+    for (const auto& s : _segments) {
+        m.add(s);
+    }
+    m.advance_insync_offset(_insync_offset);
+    return true;
+}
+
+ss::future<> partition_manifest_delta::update(ss::input_stream<char> is) {
+    iobuf result;
+    auto os = make_iobuf_ref_output_stream(result);
+    co_await ss::copy(is, os).finally([&is, &os]() mutable {
+        return is.close().finally([&os]() mutable { return os.close(); });
+    });
+    auto s = serde::from_iobuf<partition_manifest_delta_serde>(
+      std::move(result));
+    _ntp = std::move(s.ntp);
+    _rev = s.rev;
+    _base = s.base;
+    _insync_offset = s.insync_offset;
+    _segments = std::move(s.segments);
+}
+
+ss::future<serialized_data_stream> partition_manifest_delta::serialize() const {
+    partition_manifest_delta_serde s{
+      .ntp = _ntp,
+      .rev = _rev,
+      .base = _base,
+      .insync_offset = _insync_offset,
+      .segments = _segments.copy(),
+    };
+    auto serialized = serde::to_iobuf(std::move(s));
+    size_t size_bytes = serialized.size_bytes();
+    co_return serialized_data_stream{
+      .stream = make_iobuf_input_stream(std::move(serialized)),
+      .size_bytes = size_bytes};
+}
+
+remote_manifest_path partition_manifest_delta::get_manifest_path() const {
+    return generate_partition_manifest_delta_path(_ntp, _rev);
+}
+
+} // namespace cloud_storage
@@ -0,0 +1,101 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Licensed as a Redpanda Enterprise file under the Redpanda Community
+ * License (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ * https://github.com/redpanda-data/redpanda/blob/master/licenses/rcl.md
+ */
+
+#pragma once
+
+#include "cloud_storage/base_manifest.h"
+#include "cloud_storage/partition_manifest.h"
+#include "cloud_storage/types.h"
+#include "model/fundamental.h"
+#include "model/metadata.h"
+#include "serde/envelope.h"
+#include "utils/fragmented_vector.h"
+
+#include <optional>
+
+namespace cloud_storage {
+
+/// Path of the delta object of the partition manifest of ntp/rev
+remote_manifest_path generate_partition_manifest_delta_path(
+  const model::ntp& ntp, model::initial_revision_id rev);
+
+/// Identifies the state of a partition manifest that a delta applies to
+struct partition_manifest_delta_base
+  : serde::envelope<
+      partition_manifest_delta_base,
+      serde::version<0>,
+      serde::compat_version<0>> {
+    model::offset insync_offset;
+    model::offset last_offset;
+    /// Digest of everything in the manifest that a delta can't express:
+    /// start offsets, archive bounds, spillover and replaced segments.
+    uint64_t fingerprint{0};
+
+    static partition_manifest_delta_base from(const partition_manifest& m);
+
+    bool operator==(const partition_manifest_delta_base&) const = default;
+};
+
+std::ostream& operator<<(std::ostream&, const partition_manifest_delta_base&);
+
+/// Segments appended to a partition manifest since its last full upload.
+///
+/// When the only change to a manifest since its last upload is new segments
+/// at the end of the log, the archiver uploads this object instead of the
+/// full manifest. The delta is cumulative: it holds every segment added since
+/// the full manifest it refers to (the base), so each upload overwrites the
+/// previous delta and readers only need the base and one delta object.
+///
+/// A delta applies to a base manifest if the base still matches the
+/// partition_manifest_delta_base the delta was made against. Any other kind
+/// of change (retention, spillover, reuploads) needs a full manifest upload.
+class partition_manifest_delta final : public base_manifest {
+public:
+    /// Create an empty delta that is supposed to be updated later
+    partition_manifest_delta(model::ntp ntp, model::initial_revision_id rev);
+
+    /// Make a delta of \p m against \p base, if \p m only differs from base
+    /// by appended segments.
+    static std::optional<partition_manifest_delta> make(
+      const partition_manifest& m, const partition_manifest_delta_base& base);
+
+    /// Apply the delta to \p m, which should be the base manifest it was made
+    /// against. Returns false, leaving \p m untouched, if it isn't.
+    bool apply(partition_manifest& m) const;
+
+    const partition_manifest_delta_base& base() const { return _base; }
+
+    /// Number of segments in the delta
+    size_t size() const { return _segments.size(); }
+
+    ss::future<> update(ss::input_stream<char> is) override;
+
+    ss::future<serialized_data_stream> serialize() const override;
+
+    remote_manifest_path get_manifest_path() const override;
+
+    std::pair<manifest_format, remote_manifest_path>
+    get_manifest_format_and_path() const override {
+        return {manifest_format::serde, get_manifest_path()};
+    }
+
+    manifest_type get_manifest_type() const override {
+        return manifest_type::partition;
+    }
+
+private:
+    model::ntp _ntp;
+    model::initial_revision_id _rev;
+    partition_manifest_delta_base _base;
+    model::offset _insync_offset;
+    fragmented_vector<segment_meta> _segments;
+};
+
+} // namespace cloud_storage
@@ -14,9 +14,11 @@
 #include "cloud_storage/base_manifest.h"
 #include "cloud_storage/logger.h"
 #include "cloud_storage/materialized_resources.h"
+#include "cloud_storage/partition_manifest_delta.h"
 #include "cloud_storage/types.h"
 #include "cloud_storage_clients/client_pool.h"
 #include "cloud_storage_clients/util.h"
+#include "config/configuration.h"
 #include "model/metadata.h"
 #include "ssx/semaphore.h"
 #include "utils/retry_chain_node.h"
@@ -223,6 +225,16 @@ remote::try_download_partition_manifest(
     auto format_path = manifest.get_manifest_format_and_path();
     auto serde_result = co_await do_download_manifest(
       bucket, format_path, manifest, parent, expect_missing);
+    if (
+      serde_result == download_result::success
+      && config::shard_local_cfg().cloud_storage_manifest_delta_segments()
+           > 0) {
+        auto delta_result = co_await try_apply_partition_manifest_delta(
+          bucket, manifest, parent);
+        if (delta_result != download_result::notfound) {
+            serde_result = delta_result;
+        }
+    }
     if (serde_result != download_result::notfound) {
         // propagate success, timedout and failed to caller
         co_return std::pair{serde_result, manifest_format::serde};
@@ -235,6 +247,31 @@ remote::try_download_partition_manifest(
       manifest_format::json};
 }
 
+ss::future<download_result> remote::try_apply_partition_manifest_delta(
+  const cloud_storage_clients::bucket_name& bucket,
+  partition_manifest& manifest,
+  retry_chain_node& parent) {
+    partition_manifest_delta delta(
+      manifest.get_ntp(), manifest.get_revision_id());
+    auto result = co_await do_download_manifest(
+      bucket, delta.get_manifest_format_and_path(), delta, parent, true);
+    if (result != download_result::success) {
+        co_return result;
+    }
+    if (!delta.apply(manifest)) {
+        // The delta was made against an older base, which has since been
+        // replaced by a full upload of the manifest
+        vlog(
+          cst_log.debug,
+          "Ignoring manifest delta of {}, base {} doesn't match manifest "
+          "insync_offset {}",
+          manifest.get_ntp(),
+          delta.base(),
+          manifest.get_insync_offset());
+    }
+    co_return download_result::success;
+}
+
 ss::future<download_result> remote::do_download_manifest(
   const cloud_storage_clients::bucket_name& bucket,
   const std::pair<manifest_format, remote_manifest_path>& format_key,
@@ -239,6 +239,16 @@ public:
       retry_chain_node& parent,
       bool expect_missing = false);
 
+    /// \brief Merge the delta object of a partition manifest, if there is
+    /// one, into \p manifest, which must have been downloaded in serde
+    /// format. A delta that doesn't apply to \p manifest is ignored.
+    ///
+    /// \return notfound if there is no delta, success if it was looked at
+    ss::future<download_result> try_apply_partition_manifest_delta(
+      const cloud_storage_clients::bucket_name& bucket,
+      partition_manifest& manifest,
+      retry_chain_node& parent);
+
     /// \brief Upload manifest to the pre-defined S3 location
     ///
     /// \param bucket is a bucket name
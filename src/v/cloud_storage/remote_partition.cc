@@ -1412,7 +1412,7 @@ cache_usage_target remote_partition::get_cache_usage_target() const {
     if (seg.has_value()) {
         const auto chunked
           = !config::shard_local_cfg().cloud_storage_disable_chunk_reads()
-            && seg.value().sname_format > segment_name_format::v2;
+            && seg.value().sname_format == segment_name_format::v3;
         if (chunked) {
             return cache_usage_target{
               .target_min_bytes
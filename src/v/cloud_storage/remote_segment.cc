@@ -18,6 +18,7 @@
 #include "cloud_storage/partition_manifest.h"
 #include "cloud_storage/remote_segment_index.h"
 #include "cloud_storage/segment_chunk_data_source.h"
+#include "cloud_storage/segment_compression.h"
 #include "cloud_storage/tx_range_manifest.h"
 #include "cloud_storage/types.h"
 #include "config/configuration.h"
@@ -502,12 +503,17 @@ ss::future<> remote_segment::do_hydrate_segment() {
     auto res = co_await _api.download_segment(
       _bucket,
       _path,
-      [this, &reservation](uint64_t size_bytes, ss::input_stream<char> s) {
+      [this, &reservation](
+        uint64_t size_bytes,
+        ss::input_stream<char> s) -> ss::future<uint64_t> {
+          // Small segments may have been uploaded compressed
+          auto segment = co_await maybe_uncompress_segment_stream(
+            size_bytes, _size, std::move(s));
           // Always create the index because we are in legacy mode if we ended
           // up hydrating the segment. Legacy mode indicates a missing index, so
           // we create it here on the fly using the downloaded segment.
-          return put_segment_in_cache_and_create_index(
-            size_bytes, reservation, std::move(s));
+          co_return co_await put_segment_in_cache_and_create_index(
+            size_bytes, reservation, std::move(segment));
       },
       local_rtc);
 
@@ -557,7 +563,7 @@ ss::future<> remote_segment::do_hydrate_txrange() {
     ss::gate::holder guard(_gate);
     retry_chain_node local_rtc(
       cache_hydration_timeout, cache_hydration_backoff, &_rtc);
-    if (_sname_format == segment_name_format::v3 && _metadata_size_hint == 0) {
+    if (_sname_format >= segment_name_format::v3 && _metadata_size_hint == 0) {
         // The tx-manifest is empty, no need to download it, and
         // avoid putting this empty manifest into the cache.
         _tx_range.emplace();
@@ -758,7 +764,8 @@ void remote_segment::set_waiter_errors(const std::exception_ptr& err) {
 };
 
 bool remote_segment::is_legacy_mode_engaged() const {
-    return _fallback_mode || _sname_format <= segment_name_format::v2;
+    return _fallback_mode || _sname_format <= segment_name_format::v2
+           || _sname_format == segment_name_format::v4;
 }
 
 bool remote_segment::is_state_materialized() const {
@@ -0,0 +1,118 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Licensed as a Redpanda Enterprise file under the Redpanda Community
+ * License (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ * https://github.com/redpanda-data/redpanda/blob/master/licenses/rcl.md
+ */
+
+#include "cloud_storage/segment_compression.h"
+
+#include "bytes/iobuf_parser.h"
+#include "bytes/iostream.h"
+#include "compression/async_stream_zstd.h"
+
+#include <seastar/core/coroutine.hh>
+#include <seastar/core/iostream.hh>
+
+#include <algorithm>
+#include <array>
+#include <stdexcept>
+#include <string_view>
+
+namespace cloud_storage {
+
+namespace {
+
+// A zstd skippable frame: magic (0x184D2A5E, little endian), payload size
+// (8, little endian) and the payload, which is the marker itself.
+constexpr std::array<char, 16> compressed_segment_prefix{
+  '\x5e', '\x2a', '\x4d', '\x18', '\x08', '\x00', '\x00', '\x00',
+  'r',    'p',    's',    'e',    'g',    'z',    's',    't'};
+
+// Replays the bytes read ahead of a stream, then the rest of the stream
+class prefixed_data_source final : public ss::data_source_impl {
+public:
+    prefixed_data_source(
+      ss::temporary_buffer<char> prefix, ss::input_stream<char> in)
+      : _prefix(std::move(prefix))
+      , _in(std::move(in)) {}
+
+    ss::future<ss::temporary_buffer<char>> get() final {
+        if (!_prefix.empty()) {
+            return ss::make_ready_future<ss::temporary_buffer<char>>(
+              std::move(_prefix));
+        }
+        return _in.read();
+    }
+
+    ss::future<> close() final { return _in.close(); }
+
+private:
+    ss::temporary_buffer<char> _prefix;
+    ss::input_stream<char> _in;
+};
+
+} // namespace
+
+ss::future<iobuf> compress_segment(iobuf segment) {
+    iobuf object;
+    object.append(
+      compressed_segment_prefix.data(), compressed_segment_prefix.size());
+    object.append(co_await compression::async_stream_zstd_instance().compress(
+      std::move(segment)));
+    co_return object;
+}
+
+ss::future<iobuf> maybe_compress_segment(iobuf segment) {
+    auto object = co_await compress_segment(
+      segment.share(0, segment.size_bytes()));
+    if (object.size_bytes() < segment.size_bytes()) {
+        co_return object;
+    }
+    co_return segment;
+}
+
+bool is_compressed_segment(const iobuf& object) {
+    if (object.size_bytes() < compressed_segment_prefix.size()) {
+        return false;
+    }
+    iobuf_const_parser parser(object);
+    return parser.read_string(compressed_segment_prefix.size())
+           == std::string_view(
+             compressed_segment_prefix.data(),
+             compressed_segment_prefix.size());
+}
+
+ss::future<ss::input_stream<char>> maybe_uncompress_segment_stream(
+  uint64_t object_size, uint64_t segment_size, ss::input_stream<char> in) {
+    auto prefix = co_await in.read_exactly(compressed_segment_prefix.size());
+    // Compression is told by the marker, never by sizes alone
+    if (!std::equal(
+          prefix.begin(),
+          prefix.end(),
+          compressed_segment_prefix.begin(),
+          compressed_segment_prefix.end())) {
+        co_return ss::input_stream<char>(ss::data_source(
+          std::make_unique<prefixed_data_source>(
+            std::move(prefix), std::move(in))));
+    }
+    // Only small segments are compressed, so the object is read into memory
+    auto object = co_await read_iobuf_exactly(
+      in, object_size - compressed_segment_prefix.size());
+    co_await in.close();
+    auto segment = co_await compression::async_stream_zstd_instance()
+                     .uncompress(std::move(object));
+    if (segment.size_bytes() != segment_size) {
+        throw std::runtime_error(fmt::format(
+          "compressed segment object of {} bytes holds {} bytes, expected {}",
+          object_size,
+          segment.size_bytes(),
+          segment_size));
+    }
+    co_return make_iobuf_input_stream(std::move(segment));
+}
+
+} // namespace cloud_storage
@@ -0,0 +1,51 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Licensed as a Redpanda Enterprise file under the Redpanda Community
+ * License (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ * https://github.com/redpanda-data/redpanda/blob/master/licenses/rcl.md
+ */
+
+#pragma once
+
+#include "bytes/iobuf.h"
+#include "seastarx.h"
+
+#include <seastar/core/future.hh>
+#include <seastar/core/iostream.hh>
+
+#include <cstdint>
+
+namespace cloud_storage {
+
+/// Object level compression of uploaded segments.
+///
+/// A compressed segment object is a zstd skippable frame with a fixed marker,
+/// followed by the zstd compressed segment. A segment starts with a record
+/// batch header whose size field can't hold the marker frame's size, so the
+/// two can't be confused, and readers tell them apart by the marker. A
+/// segment is only uploaded compressed when that makes the object smaller,
+/// e.g. not when its batches are already compressed by the producer.
+///
+/// Compressed segments have no index object, they are always downloaded whole.
+
+/// Compress \p segment into a compressed segment object
+ss::future<iobuf> compress_segment(iobuf segment);
+
+/// The object to upload for \p segment: a compressed segment object if it is
+/// smaller than the segment, the segment itself otherwise.
+ss::future<iobuf> maybe_compress_segment(iobuf segment);
+
+/// Whether \p object starts like a compressed segment object
+bool is_compressed_segment(const iobuf& object);
+
+/// The content of the segment object stream \p in of \p object_size bytes,
+/// for a segment of \p segment_size bytes, uncompressed if the object is a
+/// compressed segment. The original stream's content is returned as is
+/// otherwise.
+ss::future<ss::input_stream<char>> maybe_uncompress_segment_stream(
+  uint64_t object_size, uint64_t segment_size, ss::input_stream<char> in);
+
+} // namespace cloud_storage
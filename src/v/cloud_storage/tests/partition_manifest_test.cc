@@ -13,6 +13,7 @@
 #include "bytes/iostream.h"
 #include "cloud_storage/base_manifest.h"
 #include "cloud_storage/partition_manifest.h"
+#include "cloud_storage/partition_manifest_delta.h"
 #include "cloud_storage/spillover_manifest.h"
 #include "cloud_storage/types.h"
 #include "model/fundamental.h"
@@ -1041,6 +1042,34 @@ SEASTAR_THREAD_TEST_CASE(test_replaced_sname_format_version) {
     BOOST_REQUIRE_EQUAL(replaced[3].sname_format, segment_name_format::v3);
 }
 
+SEASTAR_THREAD_TEST_CASE(test_unindexed_segment_json_roundtrip) {
+    // v4 segments are named like v3 ones and keep their tx-manifest size
+    partition_manifest m(manifest_ntp, model::initial_revision_id(0));
+    m.add(
+      segment_name("0-1-v1.log"),
+      {
+        .size_bytes = 100,
+        .base_offset = model::offset{0},
+        .committed_offset = model::offset{9},
+        .segment_term = model::term_id{1},
+        .sname_format = segment_name_format::v4,
+        .metadata_size_hint = 2,
+      });
+
+    std::stringstream sstr;
+    m.serialize_json(sstr);
+
+    partition_manifest m2;
+    m2.update(manifest_format::json, make_manifest_stream(sstr.str())).get();
+    auto meta = m2.get(model::offset{0});
+    BOOST_REQUIRE(meta.has_value());
+    BOOST_REQUIRE_EQUAL(meta->sname_format, segment_name_format::v4);
+    BOOST_REQUIRE_EQUAL(meta->metadata_size_hint, 2);
+    BOOST_REQUIRE_EQUAL(
+      partition_manifest::generate_remote_segment_name(*meta),
+      segment_name("0-9-100-1-v1.log"));
+}
+
 namespace cloud_storage {
 
 struct partition_manifest_accessor {
@@ -2652,3 +2681,45 @@ SEASTAR_THREAD_TEST_CASE(test_last_partition_scrub_json_serde) {
 
     BOOST_REQUIRE(manifest == manifest_after_round_trip);
 }
+
+SEASTAR_THREAD_TEST_CASE(test_manifest_delta) {
+    partition_manifest m(manifest_ntp, model::initial_revision_id(0));
+    auto add_segment = [&m](int64_t base, int64_t last) {
+        m.add(segment_meta{
+          .size_bytes = 1024,
+          .base_offset = model::offset(base),
+          .committed_offset = model::offset(last),
+          .segment_term = model::term_id(1),
+        });
+        m.advance_insync_offset(model::offset(last + 100));
+    };
+    add_segment(0, 9);
+    add_segment(10, 19);
+
+    // What a reader finds in the bucket after a full upload
+    auto uploaded = m.clone();
+    auto base = partition_manifest_delta_base::from(uploaded);
+
+    add_segment(20, 29);
+    add_segment(30, 39);
+    auto delta = partition_manifest_delta::make(m, base);
+    BOOST_REQUIRE(delta.has_value());
+    BOOST_REQUIRE_EQUAL(delta->size(), 2);
+
+    auto [is, size] = delta->serialize().get();
+    partition_manifest_delta restored(
+      manifest_ntp, model::initial_revision_id(0));
+    restored.update(std::move(is)).get();
+    BOOST_REQUIRE_EQUAL(restored.base(), base);
+
+    auto reader = uploaded.clone();
+    BOOST_REQUIRE(restored.apply(reader));
+    BOOST_REQUIRE(reader == m);
+
+    // Only applies to the base it was made against
+    BOOST_REQUIRE(!restored.apply(reader));
+
+    // Anything but appended segments needs a full upload
+    m.truncate(model::offset(10));
+    BOOST_REQUIRE(!partition_manifest_delta::make(m, base).has_value());
+}
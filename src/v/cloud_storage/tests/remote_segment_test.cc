@@ -513,7 +513,8 @@ static partition_manifest chunk_read_baseline(
   model::offset key,
   retry_chain_node& fib,
   iobuf segment_bytes,
-  upload_index_t index_upload = upload_index_t::yes) {
+  upload_index_t index_upload = upload_index_t::yes,
+  segment_name_format sname_format = segment_name_format::v3) {
     auto conf = f.get_configuration();
     partition_manifest m(manifest_ntp, manifest_revision);
     model::initial_revision_id segment_ntp_revision{777};
@@ -529,7 +530,7 @@ static partition_manifest chunk_read_baseline(
       .max_timestamp = {},
       .delta_offset = model::offset_delta(0),
       .ntp_revision = segment_ntp_revision,
-      .sname_format = segment_name_format::v3};
+      .sname_format = sname_format};
 
     auto path = m.generate_segment_path(meta);
     f.set_expectations_and_listen({}, {{"Range"}});
@@ -704,6 +705,65 @@ FIXTURE_TEST(test_remote_segment_chunk_read_fallback, cloud_storage_fixture) {
     BOOST_REQUIRE(downloaded == segment_bytes);
 }
 
+FIXTURE_TEST(
+  test_remote_segment_small_segment_unindexed, cloud_storage_fixture) {
+    /**
+     * v4 segments have no index object. They are downloaded whole without
+     * asking for the index first, whatever the reader's own
+     * cloud_storage_segment_index_min_size is.
+     */
+    auto key = model::offset(1);
+    retry_chain_node fib(never_abort, 300s, 200ms);
+    iobuf segment_bytes = generate_segment(model::offset(1), 300);
+
+    auto m = chunk_read_baseline(
+      *this,
+      key,
+      fib,
+      segment_bytes.copy(),
+      upload_index_t::no,
+      segment_name_format::v4);
+
+    auto meta = *m.get(key);
+    partition_probe probe(manifest_ntp);
+    auto& ts_probe = api.local().materialized().get_read_path_probe();
+    remote_segment segment(
+      api.local(),
+      cache.local(),
+      bucket,
+      m.generate_segment_path(meta),
+      m.get_ntp(),
+      meta,
+      fib,
+      probe,
+      ts_probe);
+
+    auto stream = segment
+                    .offset_data_stream(
+                      m.get(key)->base_kafka_offset(),
+                      kafka::offset{100000000},
+                      std::nullopt,
+                      ss::default_priority_class())
+                    .get()
+                    .stream;
+
+    iobuf downloaded;
+    auto rds = make_iobuf_ref_output_stream(downloaded);
+    ss::copy(stream, rds).get();
+    stream.close().get();
+
+    for (const auto& req : get_requests()) {
+        BOOST_REQUIRE(!std::string_view{req.url}.ends_with(".index"));
+        BOOST_REQUIRE(!std::string_view{req.url}.ends_with(".tx"));
+    }
+    // read in legacy mode from the start, not after failing to get the index
+    BOOST_REQUIRE(!segment.is_fallback_engaged());
+
+    segment.stop().get();
+
+    BOOST_REQUIRE(downloaded == segment_bytes);
+}
+
 FIXTURE_TEST(test_chunks_initialization, cloud_storage_fixture) {
     config::shard_local_cfg().cloud_storage_cache_chunk_size.set_value(
       static_cast<uint64_t>(128_KiB));
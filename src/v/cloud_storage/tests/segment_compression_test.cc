@@ -0,0 +1,100 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Licensed as a Redpanda Enterprise file under the Redpanda Community
+ * License (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ * https://github.com/redpanda-data/redpanda/blob/master/licenses/rcl.md
+ */
+
+#include "bytes/iobuf.h"
+#include "bytes/iostream.h"
+#include "cloud_storage/segment_compression.h"
+#include "random/generators.h"
+#include "seastarx.h"
+
+#include <seastar/testing/thread_test_case.hh>
+
+#include <boost/test/unit_test.hpp>
+
+#include <string>
+
+using namespace cloud_storage;
+
+namespace {
+
+iobuf make_segment_like_data() {
+    iobuf buf;
+    for (int i = 0; i < 1000; ++i) {
+        auto record = fmt::format(
+          R"({{"id": {}, "user": "user-{}", "event": "click"}})", i, i % 7);
+        buf.append(record.data(), record.size());
+    }
+    return buf;
+}
+
+iobuf read_all(uint64_t object_size, uint64_t segment_size, iobuf object) {
+    auto in = maybe_uncompress_segment_stream(
+                object_size,
+                segment_size,
+                make_iobuf_input_stream(std::move(object)))
+                .get();
+    auto result = read_iobuf_exactly(in, segment_size).get();
+    in.close().get();
+    return result;
+}
+
+} // namespace
+
+SEASTAR_THREAD_TEST_CASE(test_segment_compression_roundtrip) {
+    auto segment = make_segment_like_data();
+    auto object = compress_segment(segment.copy()).get();
+    BOOST_REQUIRE(is_compressed_segment(object));
+    BOOST_REQUIRE_LT(object.size_bytes(), segment.size_bytes());
+
+    auto object_size = object.size_bytes();
+    auto result = read_all(
+      object_size, segment.size_bytes(), std::move(object));
+    BOOST_REQUIRE(result == segment);
+}
+
+SEASTAR_THREAD_TEST_CASE(test_segment_compression_passthrough) {
+    auto segment = make_segment_like_data();
+    BOOST_REQUIRE(!is_compressed_segment(segment));
+
+    auto size = segment.size_bytes();
+    auto result = read_all(size, size, segment.copy());
+    BOOST_REQUIRE(result == segment);
+}
+
+SEASTAR_THREAD_TEST_CASE(test_segment_compression_incompressible) {
+    // e.g. batches compressed by the producer
+    auto bytes = random_generators::get_bytes(4096);
+    iobuf segment;
+    segment.append(bytes.data(), bytes.size());
+
+    auto object = maybe_compress_segment(segment.copy()).get();
+    BOOST_REQUIRE(!is_compressed_segment(object));
+    BOOST_REQUIRE(object == segment);
+
+    auto size = segment.size_bytes();
+    auto result = read_all(size, size, std::move(object));
+    BOOST_REQUIRE(result == segment);
+}
+
+SEASTAR_THREAD_TEST_CASE(test_segment_compression_larger_object) {
+    // objects compressed regardless of their size are still recognized
+    auto bytes = random_generators::get_bytes(4096);
+    iobuf segment;
+    segment.append(bytes.data(), bytes.size());
+
+    auto object = compress_segment(segment.copy()).get();
+    BOOST_REQUIRE(is_compressed_segment(object));
+    BOOST_REQUIRE_GE(object.size_bytes(), segment.size_bytes());
+
+    auto object_size = object.size_bytes();
+    auto result = read_all(
+      object_size, segment.size_bytes(), std::move(object));
+    BOOST_REQUIRE(result == segment);
+}
@@ -73,6 +73,9 @@ std::ostream& operator<<(std::ostream& o, const segment_name_format& r) {
     case segment_name_format::v3:
         o << "{v3}";
         break;
+    case segment_name_format::v4:
+        o << "{v4}";
+        break;
     }
     return o;
 }
@@ -63,7 +63,10 @@ enum class segment_name_format : int16_t {
     // the committed offset and size are added to the name.
     v2 = 2,
     // Extra field which is used to track size of the tx-manifest is added.
-    v3 = 3
+    v3 = 3,
+    // Same as v3, but the segment was uploaded without an index object and
+    // is always downloaded whole.
+    v4 = 4
 };
 
 std::ostream& operator<<(std::ostream& o, const segment_name_format& r);
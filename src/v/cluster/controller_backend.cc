@@ -946,7 +946,8 @@ ss::future<> controller_backend::reconcile_topics() {
         return ss::max_concurrent_for_each(
                  _topic_deltas.begin(),
                  _topic_deltas.end(),
-                 1024,
+                 config::shard_local_cfg()
+                   .controller_backend_reconciliation_concurrency(),
                  [this](underlying_t::value_type& ntp_deltas) {
                      return reconcile_ntp(ntp_deltas.second);
                  })
@@ -1839,11 +1840,44 @@ ss::future<> controller_backend::add_to_shard_table(
       ntp,
       shard,
       revision);
-    return _shard_table.invoke_on_all(
-      [ntp = std::move(ntp), raft_group, shard, revision](
-        shard_table& s) mutable {
-          s.update(ntp, raft_group, shard, revision);
-      });
+    shard_table_update update{
+      .ntp = std::move(ntp),
+      .group = raft_group,
+      .shard = shard,
+      .revision = revision};
+
+    /**
+     * Partitions are reconciled concurrently, when creating the partitions of
+     * a large topic many of them are added to the shard table at the same
+     * time. Instead of broadcasting each of them, the updates requested while
+     * a broadcast is pending are broadcast together.
+     */
+    if (_shard_table_batch) {
+        auto batch = _shard_table_batch;
+        batch->updates.push_back(std::move(update));
+        co_await batch->broadcast.get_shared_future();
+        co_return;
+    }
+
+    auto batch = ss::make_lw_shared<shard_table_batch>();
+    batch->updates.push_back(std::move(update));
+    _shard_table_batch = batch;
+    // let other reconciliation fibers join the batch
+    co_await ss::yield();
+    _shard_table_batch = nullptr;
+
+    try {
+        co_await _shard_table.invoke_on_all(
+          [&updates = batch->updates](shard_table& s) {
+              for (const auto& u : updates) {
+                  s.update(u.ntp, u.group, u.shard, u.revision);
+              }
+          });
+    } catch (...) {
+        batch->broadcast.set_exception(std::current_exception());
+        throw;
+    }
+    batch->broadcast.set_value();
 }
 
 ss::future<> controller_backend::remove_from_shard_table(
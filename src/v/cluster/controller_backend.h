@@ -26,6 +26,7 @@
 #include <seastar/core/chunked_fifo.hh>
 #include <seastar/core/gate.hh>
 #include <seastar/core/sharded.hh>
+#include <seastar/core/shared_future.hh>
 
 #include <absl/container/btree_map.h>
 #include <absl/container/node_hash_map.h>
@@ -33,6 +34,7 @@
 #include <cstdint>
 #include <deque>
 #include <ostream>
+#include <vector>
 
 namespace cluster {
 
@@ -273,6 +275,19 @@ private:
 
     using underlying_t = absl::btree_map<model::ntp, deltas_t>;
 
+    struct shard_table_update {
+        model::ntp ntp;
+        raft::group_id group;
+        ss::shard_id shard;
+        model::revision_id revision;
+    };
+
+    // shard table updates broadcast together to all shards
+    struct shard_table_batch {
+        std::vector<shard_table_update> updates;
+        ss::shared_promise<> broadcast;
+    };
+
     // Topics
     ss::future<> bootstrap_controller_backend();
     /**
@@ -420,6 +435,7 @@ private:
     underlying_t _topic_deltas;
     ss::timer<> _housekeeping_timer;
     ssx::semaphore _topics_sem{1, "c/controller-be"};
+    ss::lw_shared_ptr<shard_table_batch> _shard_table_batch;
     ss::gate _gate;
     /**
      * This map is populated by backend instance on shard that given NTP is
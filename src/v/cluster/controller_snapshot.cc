@@ -11,6 +11,8 @@
 
 #include "cluster/controller_snapshot.h"
 
+#include "vassert.h"
+
 namespace cluster {
 
 namespace controller_snapshot_parts {
@@ -201,4 +203,41 @@ controller_snapshot::serde_async_read(iobuf_parser& in, serde::header const h) {
     }
 }
 
+namespace {
+
+template<typename Part>
+ss::future<> maybe_serialize_section(iobuf& section, Part part) {
+    if (section.empty()) {
+        co_await serde::write_async(section, std::move(part));
+    }
+}
+
+} // namespace
+
+ss::future<>
+serialized_controller_snapshot::serialize_missing(controller_snapshot snap) {
+    co_await maybe_serialize_section(
+      sections[bootstrap], std::move(snap.bootstrap));
+    co_await maybe_serialize_section(
+      sections[features], std::move(snap.features));
+    co_await maybe_serialize_section(
+      sections[members], std::move(snap.members));
+    co_await maybe_serialize_section(sections[config], std::move(snap.config));
+    co_await maybe_serialize_section(sections[topics], std::move(snap.topics));
+    co_await maybe_serialize_section(
+      sections[security], std::move(snap.security));
+    co_await maybe_serialize_section(
+      sections[metrics_reporter], std::move(snap.metrics_reporter));
+    co_await maybe_serialize_section(
+      sections[plugins], std::move(snap.plugins));
+}
+
+ss::future<> serialized_controller_snapshot::serde_async_write(iobuf& out) {
+    for (auto& section : sections) {
+        vassert(!section.empty(), "controller snapshot section missing");
+        out.append(std::move(section));
+    }
+    return ss::now();
+}
+
 } // namespace cluster
@@ -25,6 +25,8 @@
 #include <absl/container/flat_hash_set.h>
 #include <absl/container/node_hash_map.h>
 
+#include <array>
+
 namespace cluster {
 
 namespace controller_snapshot_parts {
@@ -247,6 +249,40 @@ struct controller_snapshot
     ss::future<> serde_async_read(iobuf_parser&, serde::header const);
 };
 
+/// A controller snapshot assembled from sections that were serialized one
+/// by one, in the order of controller_snapshot fields. Serializes to the same
+/// bytes as the controller_snapshot itself, so that sections which did not
+/// change since the previous snapshot can be reused as they are instead of
+/// being filled and serialized again.
+struct serialized_controller_snapshot
+  : public serde::checksum_envelope<
+      serialized_controller_snapshot,
+      serde::version<controller_snapshot::redpanda_serde_version>,
+      serde::compat_version<
+        controller_snapshot::redpanda_serde_compat_version>> {
+    /// Sections in the order they are serialized in
+    enum section_id : size_t {
+        bootstrap,
+        features,
+        members,
+        config,
+        topics,
+        security,
+        metrics_reporter,
+        plugins,
+        sections_count,
+    };
+
+    /// Empty for sections that are not serialized yet
+    std::array<iobuf, sections_count> sections;
+
+    /// Serialize the sections of \p snap that are not serialized yet. Parts
+    /// are released as soon as they are serialized.
+    ss::future<> serialize_missing(controller_snapshot snap);
+
+    ss::future<> serde_async_write(iobuf&);
+};
+
 /// A subset of the controller snapshot used to initialize nodes joining
 /// the cluster.  This does not include any of the large per-partition
 /// structures.
@@ -119,28 +119,74 @@ controller_stm::maybe_make_snapshot(ssx::semaphore_units apply_mtx_holder) {
 
     data.metrics_reporter.cluster_info = _metrics_reporter_cluster_info;
 
+    // sections whose state did not change since the previous snapshot are
+    // neither filled nor serialized again.
+    const auto topics_generation
+      = state_generation<topic_updates_dispatcher>();
+    const auto security_generation = state_generation<security_manager>();
+    const bool reuse_topics = _topics_section.is_valid_for(topics_generation);
+    const bool reuse_security = _security_section.is_valid_for(
+      security_generation);
+
     ss::future<> fill_fut = ss::now();
-    auto call_stm_fill = [&fill_fut, &data](auto& stm) {
-        fill_fut = fill_fut.then(
-          [&data, &stm] { return stm.fill_snapshot(data); });
-    };
+    auto call_stm_fill =
+      [&fill_fut, &data, reuse_topics, reuse_security](auto& stm) {
+          using stm_t = std::decay_t<decltype(stm)>;
+          if constexpr (std::is_same_v<stm_t, topic_updates_dispatcher>) {
+              if (reuse_topics) {
+                  return;
+              }
+          } else if constexpr (std::is_same_v<stm_t, security_manager>) {
+              if (reuse_security) {
+                  return;
+              }
+          }
+          fill_fut = fill_fut.then(
+            [&data, &stm] { return stm.fill_snapshot(data); });
+      };
     std::apply(
       [call_stm_fill](auto&&... stms) { (call_stm_fill(stms), ...); }, _state);
     co_await std::move(fill_fut);
 
     vlog(
       clusterlog.info,
-      "created snapshot at offset {} in {} ms",
+      "created snapshot at offset {} in {} ms (reused topics: {}, reused "
+      "security: {})",
       get_last_applied_offset(),
-      (ss::steady_clock_type::now() - started_at) / 1ms);
+      (ss::steady_clock_type::now() - started_at) / 1ms,
+      reuse_topics,
+      reuse_security);
 
     // release apply_mtx and let the stm continue operation while we are
     // serializing.
     apply_mtx_holder.return_all();
     co_await ss::yield();
 
+    using sections = serialized_controller_snapshot;
+    serialized_controller_snapshot serialized;
+    if (reuse_topics) {
+        serialized.sections[sections::topics] = _topics_section.buf->share(
+          0, _topics_section.buf->size_bytes());
+    }
+    if (reuse_security) {
+        serialized.sections[sections::security]
+          = _security_section.buf->share(
+            0, _security_section.buf->size_bytes());
+    }
+
+    co_await serialized.serialize_missing(std::move(data));
+
+    auto& topics = serialized.sections[sections::topics];
+    _topics_section = {
+      .generation = topics_generation,
+      .buf = topics.share(0, topics.size_bytes())};
+    auto& security = serialized.sections[sections::security];
+    _security_section = {
+      .generation = security_generation,
+      .buf = security.share(0, security.size_bytes())};
+
     iobuf snapshot_buf;
-    co_await serde::write_async(snapshot_buf, std::move(data));
+    co_await serde::write_async(snapshot_buf, std::move(serialized));
     co_return snapshot_buf;
 }
 
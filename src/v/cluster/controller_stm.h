@@ -84,12 +84,28 @@ private:
     ss::future<> apply_snapshot(model::offset, storage::snapshot_reader&) final;
 
 private:
+    // A serialized snapshot section along with the generation of the state
+    // it was filled from.
+    struct cached_section {
+        uint64_t generation{0};
+        std::optional<iobuf> buf;
+
+        bool is_valid_for(uint64_t current) const {
+            return buf.has_value() && generation == current;
+        }
+    };
+
     controller_log_limiter _limiter;
     const features::feature_table& _feature_table;
     config::binding<std::chrono::seconds> _snapshot_max_age;
 
     metrics_reporter_cluster_info _metrics_reporter_cluster_info;
 
+    // Topics and security are by far the largest sections of the snapshot,
+    // they are reused by the next snapshot unless their state changes.
+    cached_section _topics_section;
+    cached_section _security_section;
+
     ss::timer<ss::lowres_clock> _snapshot_debounce_timer;
 };
 
@@ -49,6 +49,7 @@
 
 #include <algorithm>
 #include <iterator>
+#include <limits>
 
 namespace cluster {
 
@@ -74,6 +75,10 @@ health_monitor_backend::health_monitor_backend(
   , _feature_table(feature_table)
   , _partition_leaders_table(partition_leaders_table)
   , _topic_table(topic_table)
+  // versions start at a random point so that a restarted node doesn't hand
+  // out the versions of the reports it sent before restarting
+  , _last_report_version(random_generators::get_int<int64_t>(
+      0, std::numeric_limits<int64_t>::max() / 2))
   , _local_monitor(local_monitor) {
     _leadership_notification_handle
       = _raft_manager.local().register_leadership_notification(
@@ -371,6 +376,7 @@ health_monitor_backend::dispatch_refresh_cluster_health_request(
     storage::disk_space_alert cluster_disk_health
       = storage::disk_space_alert::ok;
     _reports.clear();
+    _report_versions.clear();
     for (auto& n_report : reply.value().report->node_reports) {
         const auto id = n_report.id;
 
@@ -495,22 +501,83 @@ health_monitor_backend::maybe_refresh_cluster_health(
 
 ss::future<result<node_health_report>>
 health_monitor_backend::collect_remote_node_health(model::node_id id) {
+    std::optional<node_health_report_version> base;
+    if (auto it = _report_versions.find(id);
+        it != _report_versions.end() && _reports.contains(id)) {
+        base = it->second;
+    }
+
+    auto reply = co_await dispatch_node_health_request(id, base);
+    if (
+      reply && reply.value().delta_base
+      && !apply_node_report_delta(id, reply.value())) {
+        vlog(
+          clusterlog.debug,
+          "unable to apply incremental health report from {}, requesting a "
+          "full report",
+          id);
+        reply = co_await dispatch_node_health_request(id, std::nullopt);
+    }
+
+    if (reply && reply.value().report && reply.value().report_version) {
+        _report_versions[id] = *reply.value().report_version;
+    } else {
+        _report_versions.erase(id);
+    }
+    co_return process_node_reply(id, std::move(reply));
+}
+
+ss::future<result<get_node_health_reply>>
+health_monitor_backend::dispatch_node_health_request(
+  model::node_id id, std::optional<node_health_report_version> base) {
     const auto timeout = model::timeout_clock::now() + max_metadata_age();
+    get_node_health_request req{.filter = node_report_filter{}};
+    if (config::shard_local_cfg().health_monitor_incremental_reports()) {
+        req.incremental = true;
+        req.base_version = base;
+    }
     return _connections.local()
       .with_node_client<controller_client_protocol>(
         _raft0->self().id(),
         ss::this_shard_id(),
         id,
         max_metadata_age(),
-        [timeout](controller_client_protocol client) mutable {
+        [timeout, req = std::move(req)](
+          controller_client_protocol client) mutable {
             return client.collect_node_health_report(
-              get_node_health_request{.filter = node_report_filter{}},
-              rpc::client_opts(timeout));
+              std::move(req), rpc::client_opts(timeout));
         })
-      .then(&rpc::get_ctx_data<get_node_health_reply>)
-      .then([this, id](result<get_node_health_reply> reply) {
-          return process_node_reply(id, std::move(reply));
+      .then(&rpc::get_ctx_data<get_node_health_reply>);
+}
+
+bool health_monitor_backend::apply_node_report_delta(
+  model::node_id id, get_node_health_reply& reply) {
+    auto version_it = _report_versions.find(id);
+    auto report_it = _reports.find(id);
+    if (
+      !reply.report || version_it == _report_versions.end()
+      || report_it == _reports.end()
+      || version_it->second != *reply.delta_base) {
+        return false;
+    }
+    vlog(
+      clusterlog.trace,
+      "applying incremental health report from {}, version: {}, base: {}, "
+      "updated topics: {}, removed partitions: {}",
+      id,
+      reply.report_version,
+      reply.delta_base,
+      reply.report->topics.size(),
+      reply.removed_partitions.size());
+
+    reply.report->topics = apply_topic_status_delta(
+      report_it->second.topics,
+      topic_status_delta{
+        .updated = std::move(reply.report->topics),
+        .removed = std::move(reply.removed_partitions),
       });
+    reply.delta_base.reset();
+    return true;
 }
 
 result<node_health_report>
@@ -664,6 +731,41 @@ health_monitor_backend::collect_current_node_health(node_report_filter filter) {
 
     co_return ret;
 }
+ss::future<result<node_health_report_update>>
+health_monitor_backend::collect_current_node_health_update(
+  std::optional<node_health_report_version> base) {
+    auto report = co_await collect_current_node_health(node_report_filter{});
+    if (!report) {
+        co_return report.error();
+    }
+
+    node_health_report_update update{
+      .report = std::move(report.value()),
+      .version = ++_last_report_version,
+    };
+    if (_last_sent_report && base == _last_sent_report->version) {
+        auto delta = diff_topic_status(
+          _last_sent_report->topics, update.report.topics);
+        _last_sent_report = sent_report{
+          .version = update.version,
+          .topics = std::exchange(
+            update.report.topics, std::move(delta.updated)),
+        };
+        update.delta_base = base;
+        update.removed_partitions = std::move(delta.removed);
+    } else {
+        ss::chunked_fifo<topic_status> topics;
+        topics.reserve(update.report.topics.size());
+        std::copy(
+          update.report.topics.cbegin(),
+          update.report.topics.cend(),
+          std::back_inserter(topics));
+        _last_sent_report = sent_report{
+          .version = update.version, .topics = std::move(topics)};
+    }
+    co_return update;
+}
+
 namespace {
 
 struct ntp_leader {
@@ -71,6 +71,12 @@ public:
     ss::future<result<node_health_report>>
       collect_current_node_health(node_report_filter);
 
+    /// Collects the current node health report, relative to the report of
+    /// version \p base if it is the last one this node handed out.
+    ss::future<result<node_health_report_update>>
+      collect_current_node_health_update(
+        std::optional<node_health_report_version> base);
+
     cluster::notification_id_type register_node_callback(health_node_cb_t cb);
     void unregister_node_callback(cluster::notification_id_type id);
 
@@ -117,10 +123,23 @@ private:
     using last_reply_cache_t
       = absl::node_hash_map<model::node_id, reply_status>;
 
+    using report_version_cache_t
+      = absl::node_hash_map<model::node_id, node_health_report_version>;
+
+    // The last report this node handed out in reply to an incremental report
+    // request, next incremental report is relative to it.
+    struct sent_report {
+        node_health_report_version version;
+        ss::chunked_fifo<topic_status> topics;
+    };
+
     void tick();
     ss::future<std::error_code> collect_cluster_health();
     ss::future<result<node_health_report>>
       collect_remote_node_health(model::node_id);
+    ss::future<result<get_node_health_reply>> dispatch_node_health_request(
+      model::node_id, std::optional<node_health_report_version> base);
+    bool apply_node_report_delta(model::node_id, get_node_health_reply&);
     ss::future<std::error_code> maybe_refresh_cluster_health(
       force_refresh, model::timeout_clock::time_point);
     ss::future<std::error_code> refresh_cluster_health_cache(force_refresh);
@@ -194,6 +213,10 @@ private:
     storage::disk_space_alert _reports_disk_health
       = storage::disk_space_alert::ok;
     last_reply_cache_t _last_replies;
+    // versions of the cached reports which were collected incrementally
+    report_version_cache_t _report_versions;
+    std::optional<sent_report> _last_sent_report;
+    node_health_report_version _last_report_version;
     std::optional<size_t> _bytes_in_cloud_storage;
 
     ss::gate _gate;
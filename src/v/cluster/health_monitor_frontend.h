@@ -59,6 +59,11 @@ public:
     ss::future<result<node_health_report>>
       collect_node_health(node_report_filter);
 
+    // Collects current node health report, incrementally relative to the
+    // report of given version when possible
+    ss::future<result<node_health_report_update>>
+      collect_node_health_update(std::optional<node_health_report_version>);
+
     // Return status of all nodes
     ss::future<result<std::vector<node_state>>>
       get_nodes_status(model::timeout_clock::time_point);
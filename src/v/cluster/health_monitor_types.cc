@@ -20,6 +20,8 @@
 
 #include <seastar/core/chunked_fifo.hh>
 
+#include <absl/container/flat_hash_map.h>
+#include <absl/container/flat_hash_set.h>
 #include <fmt/ostream.h>
 
 #include <algorithm>
@@ -192,6 +194,129 @@ std::ostream& operator<<(std::ostream& o, const topic_status& tl) {
     return o;
 }
 
+topic_status_delta diff_topic_status(
+  const ss::chunked_fifo<topic_status>& base,
+  const ss::chunked_fifo<topic_status>& current) {
+    absl::flat_hash_map<
+      model::topic_namespace_view,
+      const topic_status*,
+      model::topic_namespace_hash,
+      model::topic_namespace_eq>
+      base_topics;
+    base_topics.reserve(base.size());
+    for (const auto& t : base) {
+        base_topics.emplace(t.tp_ns, &t);
+    }
+
+    topic_status_delta delta;
+    absl::flat_hash_map<model::partition_id, const partition_status*>
+      base_partitions;
+    for (const auto& t : current) {
+        ss::chunked_fifo<partition_status> updated;
+        auto it = base_topics.find(t.tp_ns);
+        if (it == base_topics.end()) {
+            std::copy(
+              t.partitions.cbegin(),
+              t.partitions.cend(),
+              std::back_inserter(updated));
+        } else {
+            base_partitions.clear();
+            for (const auto& p : it->second->partitions) {
+                base_partitions.emplace(p.id, &p);
+            }
+            for (const auto& p : t.partitions) {
+                auto p_it = base_partitions.find(p.id);
+                if (p_it == base_partitions.end()) {
+                    updated.push_back(p);
+                    continue;
+                }
+                if (*p_it->second != p) {
+                    updated.push_back(p);
+                }
+                base_partitions.erase(p_it);
+            }
+            for (const auto& [id, _] : base_partitions) {
+                delta.removed.emplace_back(t.tp_ns.ns, t.tp_ns.tp, id);
+            }
+            base_topics.erase(it);
+        }
+        if (!updated.empty()) {
+            delta.updated.emplace_back(t.tp_ns, std::move(updated));
+        }
+    }
+
+    for (const auto& [tp_ns, t] : base_topics) {
+        for (const auto& p : t->partitions) {
+            delta.removed.emplace_back(tp_ns.ns, tp_ns.tp, p.id);
+        }
+    }
+    return delta;
+}
+
+ss::chunked_fifo<topic_status> apply_topic_status_delta(
+  const ss::chunked_fifo<topic_status>& base, topic_status_delta delta) {
+    struct topic_changes {
+        absl::flat_hash_map<model::partition_id, partition_status> updated;
+        absl::flat_hash_set<model::partition_id> removed;
+    };
+    absl::node_hash_map<model::topic_namespace, topic_changes> changes;
+    for (auto& t : delta.updated) {
+        auto& updated = changes[t.tp_ns].updated;
+        for (auto& p : t.partitions) {
+            auto id = p.id;
+            updated.insert_or_assign(id, std::move(p));
+        }
+    }
+    for (auto& ntp : delta.removed) {
+        model::topic_namespace tp_ns(
+          std::move(ntp.ns), std::move(ntp.tp.topic));
+        changes[tp_ns].removed.insert(ntp.tp.partition);
+    }
+
+    ss::chunked_fifo<topic_status> topics;
+    topics.reserve(base.size());
+    for (const auto& t : base) {
+        auto it = changes.find(t.tp_ns);
+        if (it == changes.end()) {
+            topics.push_back(t);
+            continue;
+        }
+        auto& [updated, removed] = it->second;
+        ss::chunked_fifo<partition_status> partitions;
+        for (const auto& p : t.partitions) {
+            if (removed.contains(p.id)) {
+                continue;
+            }
+            if (auto u_it = updated.find(p.id); u_it != updated.end()) {
+                partitions.push_back(std::move(u_it->second));
+                updated.erase(u_it);
+            } else {
+                partitions.push_back(p);
+            }
+        }
+        // partitions which were not reported before
+        for (auto& [_, p] : updated) {
+            partitions.push_back(std::move(p));
+        }
+        changes.erase(it);
+        if (!partitions.empty()) {
+            topics.emplace_back(t.tp_ns, std::move(partitions));
+        }
+    }
+
+    // topics which were not reported before
+    for (auto& [tp_ns, c] : changes) {
+        ss::chunked_fifo<partition_status> partitions;
+        for (auto& [_, p] : c.updated) {
+            partitions.push_back(std::move(p));
+        }
+        if (!partitions.empty()) {
+            topics.emplace_back(tp_ns, std::move(partitions));
+        }
+    }
+    return topics;
+}
+
 std::ostream& operator<<(std::ostream& o, const node_report_filter& s) {
     fmt::print(
       o,
@@ -232,12 +357,25 @@ std::ostream& operator<<(std::ostream& o, const partitions_filter& filter) {
 
 std::ostream& operator<<(std::ostream& o, const get_node_health_request& r) {
     fmt::print(
-      o, "{{filter: {}, current_version: {}}}", r.filter, r.current_version);
+      o,
+      "{{filter: {}, current_version: {}, incremental: {}, base_version: {}}}",
+      r.filter,
+      r.current_version,
+      r.incremental,
+      r.base_version);
     return o;
 }
 
 std::ostream& operator<<(std::ostream& o, const get_node_health_reply& r) {
-    fmt::print(o, "{{error: {}, report: {}}}", r.error, r.report);
+    fmt::print(
+      o,
+      "{{error: {}, report: {}, report_version: {}, delta_base: {}, "
+      "removed_partitions: {}}}",
+      r.error,
+      r.report,
+      r.report_version,
+      r.delta_base,
+      r.removed_partitions);
     return o;
 }
 
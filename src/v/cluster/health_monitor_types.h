@@ -25,6 +25,8 @@
 #include <absl/container/node_hash_set.h>
 
 #include <chrono>
+#include <optional>
+#include <vector>
 
 namespace cluster {
 
@@ -188,6 +190,48 @@ struct node_health_report
     operator==(const node_health_report& a, const node_health_report& b);
 };
 
+/**
+ * Incremental node health reports
+ *
+ * With tens of thousands of partitions a node health report weighs
+ * megabytes, while only a small part of it changes between two reports. The
+ * controller leader may instead ask a node for an incremental report: the node
+ * tags every report it sends with a version and, when asked for a report
+ * relative to the last version it sent, only sends the partitions whose
+ * status changed since then, together with the partitions it no longer hosts.
+ * Any mismatch of versions falls back to a full report.
+ */
+using node_health_report_version
+  = named_type<int64_t, struct node_health_report_version_tag>;
+
+struct topic_status_delta {
+    // statuses of the partitions which are new or changed
+    ss::chunked_fifo<topic_status> updated;
+    // partitions which are no longer reported
+    std::vector<model::ntp> removed;
+};
+
+/// Changes of the partition statuses between \p base and \p current
+topic_status_delta diff_topic_status(
+  const ss::chunked_fifo<topic_status>& base,
+  const ss::chunked_fifo<topic_status>& current);
+
+/// Partition statuses of \p base updated with \p delta
+ss::chunked_fifo<topic_status> apply_topic_status_delta(
+  const ss::chunked_fifo<topic_status>& base, topic_status_delta delta);
+
+/**
+ * A node health report as sent in reply to an incremental report request.
+ * When delta_base is set, the report topics only hold the partitions which
+ * changed since the report of version delta_base.
+ */
+struct node_health_report_update {
+    node_health_report report;
+    node_health_report_version version;
+    std::optional<node_health_report_version> delta_base;
+    std::vector<model::ntp> removed_partitions;
+};
+
 struct cluster_health_report
   : serde::envelope<
       cluster_health_report,
@@ -322,7 +366,7 @@ using force_refresh = ss::bool_class<struct hm_force_refresh_tag>;
 struct get_node_health_request
   : serde::envelope<
       get_node_health_request,
-      serde::version<0>,
+      serde::version<1>,
       serde::compat_version<0>> {
     using rpc_adl_exempt = std::true_type;
     static constexpr int8_t initial_version = 0;
@@ -336,6 +380,10 @@ struct get_node_health_request
     node_report_filter filter;
     // this field is not serialized
     int8_t decoded_version = current_version;
+    // the requester accepts an incremental report, relative to the report of
+    // base_version if it holds one
+    bool incremental{false};
+    std::optional<node_health_report_version> base_version;
 
     friend bool
     operator==(const get_node_health_request&, const get_node_health_request&)
@@ -344,19 +392,23 @@ struct get_node_health_request
     friend std::ostream&
     operator<<(std::ostream&, const get_node_health_request&);
 
-    auto serde_fields() { return std::tie(filter); }
+    auto serde_fields() { return std::tie(filter, incremental, base_version); }
 };
 
 struct get_node_health_reply
   : serde::envelope<
       get_node_health_reply,
-      serde::version<0>,
+      serde::version<1>,
       serde::compat_version<0>> {
     using rpc_adl_exempt = std::true_type;
     static constexpr int8_t current_version = 0;
 
     errc error = cluster::errc::success;
     std::optional<node_health_report> report;
+    // set in reply to an incremental request, see node_health_report_update
+    std::optional<node_health_report_version> report_version;
+    std::optional<node_health_report_version> delta_base;
+    std::vector<model::ntp> removed_partitions;
 
     friend bool
     operator==(const get_node_health_reply&, const get_node_health_reply&)
@@ -365,7 +417,10 @@ struct get_node_health_reply
     friend std::ostream&
     operator<<(std::ostream&, const get_node_health_reply&);
 
-    auto serde_fields() { return std::tie(error, report); }
+    auto serde_fields() {
+        return std::tie(
+          error, report, report_version, delta_base, removed_partitions);
+    }
 };
 
 struct get_cluster_health_request
@@ -24,12 +24,15 @@
 #include "model/namespace.h"
 #include "model/record_batch_reader.h"
 #include "rpc/connection_cache.h"
+#include "ssx/future-util.h"
 #include "vformat.h"
 
 #include <seastar/core/coroutine.hh>
 #include <seastar/core/do_with.hh>
 #include <seastar/core/sharded.hh>
 
+#include <algorithm>
+
 namespace cluster {
 using namespace std::chrono_literals;
 
@@ -67,8 +70,9 @@ allocate_id_handler::dispatch(
 ss::future<allocate_id_reply>
 allocate_id_handler::process(ss::shard_id shard, allocate_id_request req) {
     auto timeout = req.timeout;
+    auto count = req.count;
     return _partition_manager.invoke_on(
-      shard, _ssg, [timeout](cluster::partition_manager& mgr) mutable {
+      shard, _ssg, [timeout, count](cluster::partition_manager& mgr) mutable {
           auto partition = mgr.get(model::id_allocator_ntp);
           if (!partition) {
               vlog(
@@ -87,7 +91,7 @@ allocate_id_handler::process(ss::shard_id shard, allocate_id_request req) {
               return ss::make_ready_future<allocate_id_reply>(
                 allocate_id_reply{0, errc::topic_not_exists});
           }
-          return stm->allocate_id(timeout).then(
+          return stm->allocate_id(timeout, count).then(
             [](id_allocator_stm::stm_allocation_result r) {
                 if (r.raft_status != raft::errc::success) {
                     vlog(
@@ -97,7 +101,7 @@ allocate_id_handler::process(ss::shard_id shard, allocate_id_request req) {
                     return allocate_id_reply{r.id, errc::replication_error};
                 }
 
-                return allocate_id_reply{r.id, errc::success};
+                return allocate_id_reply{r.id, errc::success, r.count};
             });
       });
 }
@@ -122,10 +126,95 @@ id_allocator_frontend::id_allocator_frontend(
       metadata_cache,
       connection_cache,
       leaders,
-      node_id) {}
+      node_id)
+  , _lease_size(config::shard_local_cfg().id_allocator_lease_size.bind()) {}
+
+ss::future<> id_allocator_frontend::stop() {
+    _lease_mutex.broken();
+    co_await _gate.close();
+    co_await _allocator_router.shutdown();
+}
 
 ss::future<allocate_id_reply>
 id_allocator_frontend::allocate_id(model::timeout_clock::duration timeout) {
+    if (auto id = take_leased_id(); id) {
+        maybe_replenish_lease(timeout);
+        co_return allocate_id_reply{*id, errc::success};
+    }
+
+    const int64_t lease_size = _lease_size();
+    if (lease_size <= 1) {
+        co_return co_await do_allocate_id(1, timeout);
+    }
+
+    auto holder = _gate.hold();
+    auto units = co_await _lease_mutex.get_units();
+    // a concurrent caller may have leased a range while we were waiting
+    if (_leases.empty()) {
+        auto reply = co_await lease_ids(lease_size, timeout);
+        if (reply.ec != errc::success) {
+            co_return reply;
+        }
+    }
+    units.return_all();
+
+    auto id = take_leased_id();
+    if (!id) {
+        co_return co_await do_allocate_id(1, timeout);
+    }
+    maybe_replenish_lease(timeout);
+    co_return allocate_id_reply{*id, errc::success};
+}
+
+std::optional<int64_t> id_allocator_frontend::take_leased_id() {
+    if (_leases.empty()) {
+        return std::nullopt;
+    }
+    auto& range = _leases.front();
+    auto id = range.next++;
+    if (range.size() == 0) {
+        _leases.pop_front();
+    }
+    return id;
+}
+
+ss::future<allocate_id_reply> id_allocator_frontend::lease_ids(
+  int64_t count, model::timeout_clock::duration timeout) {
+    auto reply = co_await do_allocate_id(count, timeout);
+    if (reply.ec == errc::success) {
+        _leases.push_back(id_range{
+          .next = reply.id,
+          .end = reply.id + std::max<int64_t>(reply.count, 1)});
+    }
+    co_return reply;
+}
+
+void id_allocator_frontend::maybe_replenish_lease(
+  model::timeout_clock::duration timeout) {
+    const int64_t lease_size = _lease_size();
+    if (lease_size <= 1 || _gate.is_closed() || !_lease_mutex.ready()) {
+        return;
+    }
+    int64_t leased = 0;
+    for (const auto& range : _leases) {
+        leased += range.size();
+    }
+    if (leased * 2 > lease_size) {
+        return;
+    }
+    ssx::spawn_with_gate(_gate, [this, lease_size, timeout] {
+        return _lease_mutex
+          .with([this, lease_size, timeout] {
+              return lease_ids(lease_size, timeout).discard_result();
+          })
+          .handle_exception([](const std::exception_ptr& e) {
+              vlog(clusterlog.debug, "failed to replenish id lease: {}", e);
+          });
+    });
+}
+
+ss::future<allocate_id_reply> id_allocator_frontend::do_allocate_id(
+  int64_t count, model::timeout_clock::duration timeout) {
     auto nt = model::topic_namespace(
       model::kafka_internal_namespace, model::id_allocator_topic);
 
@@ -141,7 +230,7 @@ id_allocator_frontend::allocate_id(model::timeout_clock::duration timeout) {
     }
 
     co_return co_await _allocator_router.process_or_dispatch(
-      allocate_id_request{timeout}, model::id_allocator_ntp, timeout);
+      allocate_id_request{timeout, count}, model::id_allocator_ntp, timeout);
 }
 
 ss::future<bool> id_allocator_frontend::try_create_id_allocator_topic() {
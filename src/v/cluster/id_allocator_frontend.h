@@ -13,12 +13,17 @@
 #include "cluster/id_allocator_service.h"
 #include "cluster/leader_router.h"
 #include "cluster/types.h"
+#include "config/property.h"
 #include "rpc/fwd.h"
+#include "utils/mutex.h"
 
 #include <seastar/core/abort_source.hh>
+#include <seastar/core/gate.hh>
 #include <seastar/core/sharded.hh>
 #include <seastar/core/smp.hh>
 
+#include <deque>
+#include <optional>
 #include <vector>
 
 namespace cluster {
@@ -86,6 +91,13 @@ private:
 //
 // when the service recieves a call it triggers id_allocator_frontend
 // which in its own turn pass the request to the id_allocator_stm
+//
+// when id_allocator_lease_size is greater than one each shard leases a
+// range of ids from the allocator and serves allocate_id from it without
+// leaving the shard. the next range is leased in the background once half
+// of the current one is used. ids are durably allocated by the stm before
+// they are leased so a lease doesn't need to be persisted: ids left in the
+// lease when the node stops are simply never handed out.
 class id_allocator_frontend {
 public:
     id_allocator_frontend(
@@ -101,11 +113,26 @@ public:
     ss::future<allocate_id_reply>
     allocate_id(model::timeout_clock::duration timeout);
 
-    ss::future<> stop() { return _allocator_router.shutdown(); }
+    ss::future<> stop();
 
     allocate_id_router& allocator_router() { return _allocator_router; }
 
 private:
+    struct id_range {
+        int64_t next;
+        int64_t end;
+
+        int64_t size() const { return end - next; }
+    };
+
+    ss::future<allocate_id_reply>
+      do_allocate_id(int64_t, model::timeout_clock::duration);
+
+    std::optional<int64_t> take_leased_id();
+    ss::future<allocate_id_reply>
+      lease_ids(int64_t, model::timeout_clock::duration);
+    void maybe_replenish_lease(model::timeout_clock::duration);
+
     ss::smp_service_group _ssg;
     ss::sharded<cluster::partition_manager>& _partition_manager;
     ss::sharded<cluster::metadata_cache>& _metadata_cache;
@@ -113,6 +140,13 @@ private:
 
     allocate_id_router _allocator_router;
 
+    config::binding<int16_t> _lease_size;
+    // leased ranges of ids, served in order
+    std::deque<id_range> _leases;
+    // serializes leasing so that concurrent callers share a single range
+    mutex _lease_mutex;
+    ss::gate _gate;
+
     // Sets the underlying stm's next id to the given id, returning an error if
     // there was a problem (e.g. not leader, timed out, etc).
     ss::future<allocate_id_reply>
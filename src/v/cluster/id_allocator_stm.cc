@@ -21,6 +21,8 @@
 #include <seastar/core/coroutine.hh>
 #include <seastar/core/future.hh>
 
+#include <algorithm>
+
 namespace cluster {
 
 template<typename T>
@@ -89,16 +91,20 @@ ss::future<bool> id_allocator_stm::set_state(
 }
 
 ss::future<id_allocator_stm::stm_allocation_result>
-id_allocator_stm::allocate_id(model::timeout_clock::duration timeout) {
+id_allocator_stm::allocate_id(
+  model::timeout_clock::duration timeout, int64_t count) {
     return _lock
-      .with(timeout, [this, timeout]() { return do_allocate_id(timeout); })
+      .with(
+        timeout,
+        [this, timeout, count]() { return do_allocate_id(timeout, count); })
       .handle_exception_type([](const ss::semaphore_timed_out&) {
           return stm_allocation_result{-1, raft::errc::timeout};
       });
 }
 
 ss::future<id_allocator_stm::stm_allocation_result>
-id_allocator_stm::do_allocate_id(model::timeout_clock::duration timeout) {
+id_allocator_stm::do_allocate_id(
+  model::timeout_clock::duration timeout, int64_t count) {
     if (!co_await sync(timeout)) {
         co_return stm_allocation_result{-1, raft::errc::timeout};
     }
@@ -112,11 +118,12 @@ id_allocator_stm::do_allocate_id(model::timeout_clock::duration timeout) {
     }
 
     auto id = _curr_id;
+    auto allocated = std::clamp<int64_t>(count, 1, _curr_batch);
 
-    _curr_id += 1;
-    _curr_batch -= 1;
+    _curr_id += allocated;
+    _curr_batch -= allocated;
 
-    co_return stm_allocation_result{id, raft::errc::success};
+    co_return stm_allocation_result{id, raft::errc::success, allocated};
 }
 
 ss::future<> id_allocator_stm::apply(const model::record_batch& b) {
@@ -37,6 +37,8 @@ public:
     struct stm_allocation_result {
         int64_t id;
         raft::errc raft_status{raft::errc::success};
+        // number of consecutive ids allocated, starting with id
+        int64_t count{1};
     };
 
     explicit id_allocator_stm(ss::logger&, raft::consensus*);
@@ -44,8 +46,10 @@ public:
     explicit id_allocator_stm(
       ss::logger&, raft::consensus*, config::configuration&);
 
+    /// Allocates up to \p count consecutive ids. Ranges never span two
+    /// batches, so fewer ids may be allocated than requested.
     ss::future<stm_allocation_result>
-    allocate_id(model::timeout_clock::duration timeout);
+    allocate_id(model::timeout_clock::duration timeout, int64_t count = 1);
 
     std::string_view get_name() const final { return "id_allocator_stm"; }
     ss::future<iobuf> take_snapshot(model::offset) final { co_return iobuf{}; }
@@ -96,7 +100,7 @@ private:
     };
 
     ss::future<stm_allocation_result>
-      do_allocate_id(model::timeout_clock::duration);
+      do_allocate_id(model::timeout_clock::duration, int64_t);
     ss::future<bool> set_state(int64_t, model::timeout_clock::duration);
 
     ss::future<> apply(const model::record_batch&) final;
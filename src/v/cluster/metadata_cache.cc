@@ -67,14 +67,15 @@ metadata_cache::get_topic_metadata_ref(model::topic_namespace_view tn) const {
 
 std::optional<model::topic_metadata> metadata_cache::get_model_topic_metadata(
   model::topic_namespace_view tp, metadata_cache::with_leaders leaders) const {
-    auto md = _topics_state.local().get_topic_metadata(tp);
-    if (!md) {
+    auto md_ref = _topics_state.local().get_topic_metadata_ref(tp);
+    if (!md_ref) {
         return std::nullopt;
     }
+    const auto& md = md_ref->get();
 
-    model::topic_metadata metadata(md->get_configuration().tp_ns);
-    metadata.partitions.reserve(md->get_assignments().size());
-    for (const auto& p_as : md->get_assignments()) {
+    model::topic_metadata metadata(md.get_configuration().tp_ns);
+    metadata.partitions.reserve(md.get_assignments().size());
+    for (const auto& p_as : md.get_assignments()) {
         metadata.partitions.push_back(p_as.create_partition_metadata());
     }
 
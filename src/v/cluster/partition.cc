@@ -15,6 +15,7 @@
 #include "cloud_storage/read_path_probes.h"
 #include "cloud_storage/remote_partition.h"
 #include "cluster/logger.h"
+#include "cluster/persisted_stm.h"
 #include "cluster/tm_stm_cache_manager.h"
 #include "cluster/types.h"
 #include "config/configuration.h"
@@ -925,6 +926,15 @@ ss::future<> partition::remove_persistent_state() {
     if (_log_eviction_stm) {
         co_await _log_eviction_stm->remove_persistent_state();
     }
+    const model::topic_namespace_view tp_ns(ntp());
+    if (tp_ns == model::kafka_consumer_offsets_nt) {
+        // the group state snapshot is written by the group manager into the
+        // partition directory, it has to be gone before the log is removed
+        prefix_logger logger(clusterlog, ssx::sformat("[{}]", ntp()));
+        file_backed_stm_snapshot snapshot(
+          group_state_snapshot, logger, _raft.get());
+        co_await snapshot.remove_persistent_state();
+    }
 }
 
 /**
@@ -13,6 +13,7 @@
 #include "bytes/streambuf.h"
 #include "cloud_storage/logger.h"
 #include "cloud_storage/recovery_utils.h"
+#include "cloud_storage/segment_compression.h"
 #include "cloud_storage/topic_manifest.h"
 #include "cloud_storage/types.h"
 #include "cluster/topic_recovery_status_frontend.h"
@@ -699,15 +700,19 @@ partition_downloader::download_segment_file(
 
     auto stream = [this,
                    &stream_stats,
+                   _size{segm.size_bytes},
                    _part{part},
                    _remote_path{remote_path},
                    _localpath{localpath},
                    _otl{otl}](
                     uint64_t len,
                     ss::input_stream<char> in) -> ss::future<uint64_t> {
-        return download_segment_file_stream(
+        // Small segments may have been uploaded compressed
+        auto segment = co_await cloud_storage::maybe_uncompress_segment_stream(
+          len, _size, std::move(in));
+        co_return co_await download_segment_file_stream(
           len,
-          std::move(in),
+          std::move(segment),
           _part,
           _remote_path,
           _localpath,
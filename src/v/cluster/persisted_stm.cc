@@ -64,7 +64,11 @@ persisted_stm<T>::persisted_stm(
   Args&&... args)
   : _raft(c)
   , _log(logger, ssx::sformat("[{} ({})]", _raft->ntp(), snapshot_mgr_name))
-  , _snapshot_backend(snapshot_mgr_name, _log, c, std::forward<Args>(args)...) {
+  , _snapshot_backend(snapshot_mgr_name, _log, c, std::forward<Args>(args)...)
+  , _snapshot_max_age(
+      config::shard_local_cfg().stm_snapshot_max_age_sec.bind()) {
+    _snapshot_timer.set_callback([this] { on_snapshot_timer(); });
+    _snapshot_max_age.watch([this] { arm_snapshot_timer(); });
 }
 
 template<supported_stm_snapshot T>
@@ -76,6 +80,7 @@ template<supported_stm_snapshot T>
 ss::future<> persisted_stm<T>::stop() {
     co_await raft::state_machine_base::stop();
     co_await _gate.close();
+    _snapshot_timer.cancel();
 }
 
 template<supported_stm_snapshot T>
@@ -292,6 +297,41 @@ void persisted_stm<T>::write_local_snapshot_in_background() {
     ssx::spawn_with_gate(_gate, [this] { return write_local_snapshot(); });
 }
 
+template<supported_stm_snapshot T>
+void persisted_stm<T>::arm_snapshot_timer() {
+    _snapshot_timer.cancel();
+    const auto max_age = _snapshot_max_age();
+    if (!max_age || _gate.is_closed() || !_snapshot_hydrated) {
+        return;
+    }
+    // spread snapshots of partitions which were started together
+    const auto base = std::chrono::duration_cast<ss::lowres_clock::duration>(
+      *max_age);
+    simple_time_jitter<ss::lowres_clock> jitter(
+      base, std::max(base / 10, ss::lowres_clock::duration(1)));
+    _snapshot_timer.arm(jitter());
+}
+
+template<supported_stm_snapshot T>
+void persisted_stm<T>::on_snapshot_timer() {
+    if (_gate.is_closed()) {
+        return;
+    }
+    if (last_applied() <= _last_snapshot_offset) {
+        arm_snapshot_timer();
+        return;
+    }
+    vlog(
+      _log.debug,
+      "snapshot older than max age, last snapshot offset: {}, last applied: "
+      "{}",
+      _last_snapshot_offset,
+      last_applied());
+    ssx::spawn_with_gate(_gate, [this] {
+        return write_local_snapshot().finally([this] { arm_snapshot_timer(); });
+    });
+}
+
 template<supported_stm_snapshot T>
 ss::future<> persisted_stm<T>::write_local_snapshot() {
     return _op_lock.with([this]() {
@@ -561,6 +601,7 @@ ss::future<> persisted_stm<T>::start() {
     }
     _snapshot_hydrated = true;
     _on_snapshot_hydrated.broadcast();
+    arm_snapshot_timer();
 }
 
 template class persisted_stm<file_backed_stm_snapshot>;
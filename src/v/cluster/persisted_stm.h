@@ -15,6 +15,7 @@
 #include "kafka/protocol/errors.h"
 #include "model/fundamental.h"
 #include "model/record.h"
+#include "random/simple_time_jitter.h"
 #include "raft/consensus.h"
 #include "raft/errc.h"
 #include "raft/logger.h"
@@ -28,6 +29,8 @@
 #include "utils/mutex.h"
 #include "utils/prefix_logger.h"
 
+#include <seastar/core/timer.hh>
+
 #include <absl/container/flat_hash_map.h>
 
 namespace cluster {
@@ -157,7 +160,10 @@ concept supported_stm_snapshot = requires(T s, stm_snapshot&& snapshot) {
  * preventing an operation on the stale state.
  *
  * To speed up the catch up process persisted_stm snapshots the state
- * and uses it as a base for replaying the commands.
+ * and uses it as a base for replaying the commands. Snapshots are taken in
+ * background whenever the log has seen enough new bytes and, so that quiet
+ * but long lived partitions do not have to replay a large part of the log,
+ * at least every `stm_snapshot_max_age_sec` if anything was applied since.
  */
 
 template<supported_stm_snapshot T = file_backed_stm_snapshot>
@@ -239,12 +245,17 @@ private:
 
     ss::future<> do_write_local_snapshot();
 
+    void arm_snapshot_timer();
+    void on_snapshot_timer();
+
     mutex _op_lock;
     std::vector<ss::lw_shared_ptr<expiring_promise<bool>>> _sync_waiters;
     ss::condition_variable _on_snapshot_hydrated;
     bool _snapshot_hydrated{false};
     T _snapshot_backend;
     model::offset _last_snapshot_offset;
+    config::binding<std::optional<std::chrono::seconds>> _snapshot_max_age;
+    ss::timer<ss::lowres_clock> _snapshot_timer;
 };
 
 } // namespace cluster
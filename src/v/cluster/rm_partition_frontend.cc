@@ -19,11 +19,14 @@
 #include "cluster/tx_helpers.h"
 #include "config/configuration.h"
 #include "errc.h"
+#include "features/feature_table.h"
 #include "rpc/connection_cache.h"
+#include "ssx/future-util.h"
 #include "types.h"
 #include "vformat.h"
 
 #include <seastar/core/coroutine.hh>
+#include <seastar/core/when_all.hh>
 
 #include <algorithm>
 
@@ -48,7 +51,20 @@ rm_partition_frontend::rm_partition_frontend(
   , _metadata_dissemination_retries(
       config::shard_local_cfg().metadata_dissemination_retries.value())
   , _metadata_dissemination_retry_delay_ms(
-      config::shard_local_cfg().metadata_dissemination_retry_delay_ms.value()) {
+      config::shard_local_cfg().metadata_dissemination_retry_delay_ms.value())
+  , _marker_linger(config::shard_local_cfg().tx_marker_linger_ms.bind()) {
+    _markers_flush_timer.set_callback([this] { flush_all_markers(); });
+}
+
+ss::future<> rm_partition_frontend::stop() {
+    _as.request_abort();
+    _markers_flush_timer.cancel();
+    for (auto& [_, pending] : std::exchange(_pending_markers, {})) {
+        for (auto& result : pending.results) {
+            result.set_value(tx_errc::timeout);
+        }
+    }
+    co_await _gate.close();
 }
 
 bool rm_partition_frontend::is_leader_of(const model::ntp& ntp) const {
@@ -305,6 +321,18 @@ ss::future<commit_tx_reply> rm_partition_frontend::dispatch_commit_tx(
   model::producer_identity pid,
   model::tx_seq tx_seq,
   model::timeout_clock::duration timeout) {
+    if (should_coalesce_markers()) {
+        return enqueue_marker(
+                 leader,
+                 tx_marker{
+                   .ntp = std::move(ntp),
+                   .pid = pid,
+                   .tx_seq = tx_seq,
+                   .type = model::control_record_type::tx_commit,
+                   .timeout = timeout})
+          .then([](tx_errc ec) { return commit_tx_reply{ec}; });
+    }
+
     return _connection_cache.local()
       .with_node_client<cluster::tx_gateway_client_protocol>(
         _controller->self(),
@@ -443,6 +471,18 @@ ss::future<abort_tx_reply> rm_partition_frontend::dispatch_abort_tx(
   model::producer_identity pid,
   model::tx_seq tx_seq,
   model::timeout_clock::duration timeout) {
+    if (should_coalesce_markers()) {
+        return enqueue_marker(
+                 leader,
+                 tx_marker{
+                   .ntp = std::move(ntp),
+                   .pid = pid,
+                   .tx_seq = tx_seq,
+                   .type = model::control_record_type::tx_abort,
+                   .timeout = timeout})
+          .then([](tx_errc ec) { return abort_tx_reply{ec}; });
+    }
+
     return _connection_cache.local()
       .with_node_client<cluster::tx_gateway_client_protocol>(
         _controller->self(),
@@ -528,4 +568,209 @@ ss::future<abort_tx_reply> rm_partition_frontend::do_abort_tx(
       });
 }
 
+bool rm_partition_frontend::should_coalesce_markers() const {
+    return _marker_linger() > 0ms
+           && _controller->get_feature_table().local().is_active(
+             features::feature::coalesced_tx_markers);
+}
+
+ss::future<tx_errc>
+rm_partition_frontend::enqueue_marker(model::node_id leader, tx_marker marker) {
+    if (_gate.is_closed()) {
+        return ss::make_ready_future<tx_errc>(tx_errc::timeout);
+    }
+    auto& pending = _pending_markers[leader];
+    pending.markers.push_back(std::move(marker));
+    auto result = pending.results.emplace_back().get_future();
+    if (pending.markers.size() >= max_markers_per_request) {
+        flush_markers(leader);
+    } else if (!_markers_flush_timer.armed()) {
+        _markers_flush_timer.arm(_marker_linger());
+    }
+    return result;
+}
+
+void rm_partition_frontend::flush_markers(model::node_id leader) {
+    auto it = _pending_markers.find(leader);
+    if (it == _pending_markers.end()) {
+        return;
+    }
+    auto pending = std::move(it->second);
+    _pending_markers.erase(it);
+    ssx::spawn_with_gate(
+      _gate, [this, leader, pending = std::move(pending)]() mutable {
+          return dispatch_markers(leader, std::move(pending));
+      });
+}
+
+void rm_partition_frontend::flush_all_markers() {
+    for (auto& [leader, pending] : std::exchange(_pending_markers, {})) {
+        ssx::spawn_with_gate(
+          _gate, [this, leader, pending = std::move(pending)]() mutable {
+              return dispatch_markers(leader, std::move(pending));
+          });
+    }
+}
+
+ss::future<> rm_partition_frontend::dispatch_markers(
+  model::node_id leader, pending_markers pending) {
+    auto timeout = std::max_element(
+                     pending.markers.begin(),
+                     pending.markers.end(),
+                     [](const tx_marker& a, const tx_marker& b) {
+                         return a.timeout < b.timeout;
+                     })
+                     ->timeout;
+    vlog(
+      txlog.trace,
+      "dispatching name:tx_markers, count:{}, from:{}, to:{}",
+      pending.markers.size(),
+      _controller->self(),
+      leader);
+
+    tx_markers_request request{.markers = std::move(pending.markers)};
+    std::optional<tx_markers_reply> reply;
+    try {
+        auto r = co_await _connection_cache.local()
+                   .with_node_client<cluster::tx_gateway_client_protocol>(
+                     _controller->self(),
+                     ss::this_shard_id(),
+                     leader,
+                     timeout,
+                     [request = std::move(request),
+                      timeout](tx_gateway_client_protocol cp) mutable {
+                         return cp.tx_markers(
+                           std::move(request),
+                           rpc::client_opts(
+                             model::timeout_clock::now() + timeout));
+                     })
+                   .then(&rpc::get_ctx_data<tx_markers_reply>);
+        if (r.has_error()) {
+            vlog(txlog.warn, "got error {} on remote tx markers", r.error());
+        } else if (r.value().results.size() != pending.results.size()) {
+            vlog(
+              txlog.warn,
+              "got {} results for {} tx markers from {}",
+              r.value().results.size(),
+              pending.results.size(),
+              leader);
+        } else {
+            reply = std::move(r.value());
+        }
+    } catch (...) {
+        vlog(
+          txlog.warn,
+          "failed to send tx markers to {}: {}",
+          leader,
+          std::current_exception());
+    }
+
+    for (size_t i = 0; i < pending.results.size(); ++i) {
+        pending.results[i].set_value(
+          reply ? reply->results[i] : tx_errc::timeout);
+    }
+}
+
+namespace {
+
+ss::future<tx_errc> apply_marker(partition_manager& mgr, tx_marker marker) {
+    auto partition = mgr.get(marker.ntp);
+    if (!partition) {
+        return ss::make_ready_future<tx_errc>(tx_errc::partition_not_found);
+    }
+
+    auto stm = partition->rm_stm();
+    if (!stm) {
+        vlog(txlog.warn, "can't get tx stm of the {}' partition", marker.ntp);
+        return ss::make_ready_future<tx_errc>(tx_errc::stm_not_found);
+    }
+
+    if (marker.type == model::control_record_type::tx_commit) {
+        return stm->commit_tx(marker.pid, marker.tx_seq, marker.timeout);
+    }
+    return stm->abort_tx(marker.pid, marker.tx_seq, marker.timeout);
+}
+
+ss::future<std::vector<tx_errc>>
+apply_markers(partition_manager& mgr, std::vector<tx_marker> markers) {
+    std::vector<ss::future<tx_errc>> futures;
+    futures.reserve(markers.size());
+    for (auto& marker : markers) {
+        futures.push_back(ss::futurize_invoke(
+          apply_marker, std::ref(mgr), std::move(marker)));
+    }
+    // a marker failing must not fail the others of the request
+    auto done = co_await ss::when_all(futures.begin(), futures.end());
+    std::vector<tx_errc> results;
+    results.reserve(done.size());
+    for (auto& f : done) {
+        if (f.failed()) {
+            vlog(
+              txlog.warn, "failed to apply tx marker: {}", f.get_exception());
+            results.push_back(tx_errc::unknown_server_error);
+        } else {
+            results.push_back(f.get());
+        }
+    }
+    co_return results;
+}
+
+} // namespace
+
+ss::future<tx_markers_reply>
+rm_partition_frontend::apply_markers_locally(tx_markers_request request) {
+    vlog(
+      txlog.trace,
+      "processing name:tx_markers, count:{}",
+      request.markers.size());
+
+    tx_markers_reply reply;
+    reply.results.resize(request.markers.size(), tx_errc::none);
+
+    // indices of the markers of the partitions led by each shard
+    absl::flat_hash_map<ss::shard_id, std::vector<size_t>> shards;
+    for (size_t i = 0; i < request.markers.size(); ++i) {
+        const auto& ntp = request.markers[i].ntp;
+        if (!is_leader_of(ntp)) {
+            reply.results[i] = tx_errc::leader_not_found;
+            continue;
+        }
+        auto shard = _shard_table.local().shard_for(ntp);
+        if (!shard) {
+            reply.results[i] = tx_errc::shard_not_found;
+            continue;
+        }
+        shards[*shard].push_back(i);
+    }
+
+    co_await ss::parallel_for_each(
+      shards, [this, &request, &reply](const auto& entry) {
+          const auto& [shard, indices] = entry;
+          std::vector<tx_marker> markers;
+          markers.reserve(indices.size());
+          for (auto i : indices) {
+              markers.push_back(std::move(request.markers[i]));
+          }
+          return _partition_manager
+            .invoke_on(
+              shard,
+              _ssg,
+              [markers = std::move(markers)](
+                partition_manager& mgr) mutable {
+                  return apply_markers(mgr, std::move(markers));
+              })
+            .then([&reply, &indices](std::vector<tx_errc> results) {
+                for (size_t j = 0; j < indices.size(); ++j) {
+                    reply.results[indices[j]] = results[j];
+                }
+            });
+      });
+
+    vlog(
+      txlog.trace,
+      "sending name:tx_markers, count:{}",
+      request.markers.size());
+    co_return reply;
+}
+
 } // namespace cluster
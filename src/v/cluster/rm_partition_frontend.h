@@ -13,11 +13,16 @@
 
 #include "cluster/fwd.h"
 #include "cluster/types.h"
+#include "config/property.h"
 #include "model/metadata.h"
 #include "rpc/fwd.h"
 #include "seastarx.h"
 
 #include <seastar/core/abort_source.hh>
+#include <seastar/core/gate.hh>
+#include <seastar/core/timer.hh>
+
+#include <absl/container/flat_hash_map.h>
 
 namespace cluster {
 
@@ -49,12 +54,22 @@ public:
       model::producer_identity,
       model::tx_seq,
       model::timeout_clock::duration);
-    ss::future<> stop() {
-        _as.request_abort();
-        return ss::make_ready_future<>();
-    }
+    ss::future<> stop();
 
 private:
+    /*
+     * Commit and abort markers bound to the same node are coalesced across
+     * transactions into a single tx_markers request, sent once the linger
+     * time elapsed since the first of them or once it is full. The receiver
+     * applies them with a single hop to each shard.
+     */
+    struct pending_markers {
+        std::vector<tx_marker> markers;
+        std::vector<ss::promise<tx_errc>> results;
+    };
+
+    static constexpr size_t max_markers_per_request = 256;
+
     ss::abort_source _as;
     ss::smp_service_group _ssg;
     ss::sharded<cluster::partition_manager>& _partition_manager;
@@ -65,6 +80,10 @@ private:
     cluster::controller* _controller;
     int16_t _metadata_dissemination_retries;
     std::chrono::milliseconds _metadata_dissemination_retry_delay_ms;
+    config::binding<std::chrono::milliseconds> _marker_linger;
+    absl::flat_hash_map<model::node_id, pending_markers> _pending_markers;
+    ss::timer<> _markers_flush_timer;
+    ss::gate _gate;
 
     bool is_leader_of(const model::ntp&) const;
 
@@ -121,6 +140,13 @@ private:
       model::tx_seq,
       model::timeout_clock::duration);
 
+    bool should_coalesce_markers() const;
+    ss::future<tx_errc> enqueue_marker(model::node_id, tx_marker);
+    void flush_markers(model::node_id);
+    void flush_all_markers();
+    ss::future<> dispatch_markers(model::node_id, pending_markers);
+    ss::future<tx_markers_reply> apply_markers_locally(tx_markers_request);
+
     friend tx_gateway;
 };
 } // namespace cluster
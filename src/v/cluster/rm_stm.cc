@@ -292,7 +292,9 @@ rm_stm::rm_stm(
   , _log_stats_interval_s(
       config::shard_local_cfg().tx_log_stats_interval_s.bind())
   , _ctx_log(txlog, ssx::sformat("[{}]", c->ntp()))
-  , _max_concurrent_producer_ids(max_concurrent_producer_ids) {
+  , _max_concurrent_producer_ids(max_concurrent_producer_ids)
+  , _max_evicted_producer_ids(
+      config::shard_local_cfg().max_evicted_producer_ids.bind()) {
     vassert(
       _feature_table.local().is_active(features::feature::transaction_ga),
       "unexpected state for transactions support. skipped a few "
@@ -1094,6 +1096,31 @@ rm_stm::known_seq(model::batch_identity bid) const {
     return std::nullopt;
 }
 
+void rm_stm::maybe_reload_evicted_seq(model::producer_identity pid) {
+    auto evicted_it = _log_state.evicted_seqs.find(pid);
+    if (evicted_it == _log_state.evicted_seqs.end()) {
+        return;
+    }
+    auto [seq_it, inserted] = _log_state.seq_table.try_emplace(pid);
+    if (inserted) {
+        const auto& evicted = evicted_it->second;
+        seq_it->second.entry.pid = pid;
+        seq_it->second.entry.seq = evicted.seq;
+        seq_it->second.entry.last_offset = evicted.last_offset;
+        seq_it->second.entry.last_write_timestamp
+          = evicted.last_write_timestamp;
+        seq_it->second.term = evicted.term;
+        _log_state.lru_idempotent_pids.push_back(seq_it->second);
+        vlog(
+          _ctx_log.trace,
+          "[pid: {}] reloaded evicted sequence state, last seq: {}",
+          pid,
+          evicted.seq);
+    }
+    _log_state.forget_evicted_seq(pid);
+    spawn_background_clean_for_pids(rm_stm::clear_type::idempotent_pids);
+}
+
 std::optional<int32_t> rm_stm::tail_seq(model::producer_identity pid) const {
     auto pid_seq = _log_state.seq_table.find(pid);
     if (pid_seq == _log_state.seq_table.end()) {
@@ -1396,6 +1423,9 @@ ss::future<result<kafka_result>> rm_stm::replicate_seq(
           bid.last_seq);
         co_return cached_r.value();
     }
+    // the producer may have been evicted while it was idle
+    maybe_reload_evicted_seq(bid.pid);
+
     // checking among the responded requests
     auto cached_offset = known_seq(bid);
     if (cached_offset) {
@@ -2231,6 +2261,7 @@ void rm_stm::apply_data(model::batch_identity bid, model::offset last_offset) {
             seq_it->second.entry.pid = bid.pid;
             seq_it->second.entry.seq = bid.last_seq;
             seq_it->second.entry.last_offset = translated;
+            _log_state.forget_evicted_seq(bid.pid);
         } else {
             vlog(
               _ctx_log.trace,
@@ -2374,6 +2405,7 @@ rm_stm::apply_local_snapshot(stm_snapshot_header hdr, iobuf&& tx_ss_buf) {
         if (it == _log_state.seq_table.end()) {
             _log_state.seq_table.try_emplace(
               it, pid, seq_entry_wrapper{.entry = std::move(entry)});
+            _log_state.forget_evicted_seq(pid);
         } else if (it->second.entry.seq < entry.seq) {
             it->second.entry = std::move(entry);
             it->second.term = model::term_id(-1);
@@ -2841,6 +2873,9 @@ ss::future<> rm_stm::clear_old_idempotent_pids() {
               "{}",
               pid_for_delete,
               _max_concurrent_producer_ids());
+            if (_max_evicted_producer_ids() > 0) {
+                _log_state.evict_seq(_log_state.lru_idempotent_pids.front());
+            }
             _log_state.lru_idempotent_pids.pop_front();
             _log_state.seq_table.erase(pid_for_delete);
             _inflight_requests.erase(pid_for_delete);
@@ -2850,6 +2885,8 @@ ss::future<> rm_stm::clear_old_idempotent_pids() {
 
         co_await ss::maybe_yield();
     }
+
+    _log_state.trim_evicted_seqs(_max_evicted_producer_ids());
 }
 
 std::ostream&
@@ -2880,8 +2917,8 @@ std::ostream& operator<<(std::ostream& o, const rm_stm::log_state& state) {
     fmt::print(
       o,
       "{{ fence_epochs: {}, ongoing_m: {}, ongoing_set: {}, prepared: {}, "
-      "aborted: {}, abort_indexes: {}, seq_table: {}, tx_seqs: {}, expiration: "
-      "{}}}",
+      "aborted: {}, abort_indexes: {}, seq_table: {}, evicted_seqs: {}, "
+      "tx_seqs: {}, expiration: {}}}",
       state.fence_pid_epoch.size(),
       state.ongoing_map.size(),
       state.ongoing_set.size(),
@@ -2889,6 +2926,7 @@ std::ostream& operator<<(std::ostream& o, const rm_stm::log_state& state) {
       state.aborted.size(),
       state.abort_indexes.size(),
       state.seq_table.size(),
+      state.evicted_seqs.size(),
       state.current_txes.size(),
       state.expiration.size());
     return o;
@@ -2923,6 +2961,14 @@ void rm_stm::setup_metrics() {
             "Number of active producers (known producer_id seq number pairs)."),
           labels)
           .aggregate(aggregate_labels),
+        sm::make_gauge(
+          "idempotency_evicted_pid_cache_size",
+          [this] { return _log_state.evicted_seqs.size(); },
+          sm::description(
+            "Number of evicted idempotent producers whose sequence state is "
+            "kept in compact form."),
+          labels)
+          .aggregate(aggregate_labels),
         sm::make_gauge(
           "idempotency_num_pids_inflight",
           [this] { return _inflight_requests.size(); },
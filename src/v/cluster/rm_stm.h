@@ -403,6 +403,7 @@ private:
     void set_seq(model::batch_identity, kafka::offset);
     void reset_seq(model::batch_identity, model::term_id);
     std::optional<int32_t> tail_seq(model::producer_identity) const;
+    void maybe_reload_evicted_seq(model::producer_identity);
 
     ss::future<result<kafka_result>> do_replicate(
       model::batch_identity,
@@ -526,7 +527,14 @@ private:
           , expiration(mt::map<
                        absl::flat_hash_map,
                        model::producer_identity,
-                       expiration_info>(_tracker)) {}
+                       expiration_info>(_tracker))
+          , evicted_seqs(mt::map<
+                         absl::flat_hash_map,
+                         model::producer_identity,
+                         evicted_seq>(_tracker))
+          , eviction_order(
+              mt::map<absl::btree_map, uint64_t, model::producer_identity>(
+                _tracker)) {}
 
         log_state(log_state&) noexcept = delete;
         log_state(log_state&&) noexcept = delete;
@@ -593,6 +601,57 @@ private:
           &seq_entry_wrapper::_hook>;
         idempotent_pids_replicate_order lru_idempotent_pids;
 
+        // Compact sequence state of the idempotent producers evicted from
+        // seq_table. It is reloaded into seq_table when the producer comes
+        // back so that its session continues instead of being rejected with
+        // an out of order sequence error.
+        struct evicted_seq {
+            int32_t seq;
+            kafka::offset last_offset;
+            model::timestamp::type last_write_timestamp;
+            model::term_id term;
+            uint64_t eviction_id;
+        };
+        mt::unordered_map_t<
+          absl::flat_hash_map,
+          model::producer_identity,
+          evicted_seq>
+          evicted_seqs;
+        // evicted_seqs in eviction order, the oldest are dropped first
+        mt::map_t<absl::btree_map, uint64_t, model::producer_identity>
+          eviction_order;
+        uint64_t next_eviction_id{0};
+
+        void evict_seq(const seq_entry_wrapper& entry) {
+            auto id = next_eviction_id++;
+            evicted_seqs.insert_or_assign(
+              entry.entry.pid,
+              evicted_seq{
+                .seq = entry.entry.seq,
+                .last_offset = entry.entry.last_offset,
+                .last_write_timestamp = entry.entry.last_write_timestamp,
+                .term = entry.term,
+                .eviction_id = id});
+            eviction_order.emplace(id, entry.entry.pid);
+        }
+
+        void forget_evicted_seq(const model::producer_identity& pid) {
+            auto it = evicted_seqs.find(pid);
+            if (it == evicted_seqs.end()) {
+                return;
+            }
+            eviction_order.erase(it->second.eviction_id);
+            evicted_seqs.erase(it);
+        }
+
+        void trim_evicted_seqs(uint64_t max) {
+            while (eviction_order.size() > max) {
+                auto it = eviction_order.begin();
+                evicted_seqs.erase(it->second);
+                eviction_order.erase(it);
+            }
+        }
+
         void unlink_lru_pid(const seq_entry_wrapper& entry) {
             if (entry._hook.is_linked()) {
                 lru_idempotent_pids.erase(
@@ -639,10 +698,13 @@ private:
             erase_pid_from_seq_table(pid);
             current_txes.erase(pid);
             expiration.erase(pid);
+            forget_evicted_seq(pid);
         }
 
         void reset() {
             clear_seq_table();
+            evicted_seqs.clear();
+            eviction_order.clear();
             fence_pid_epoch.clear();
             ongoing_map.clear();
             ongoing_set.clear();
@@ -890,6 +952,7 @@ private:
     ss::timer<clock_type> _log_stats_timer;
     prefix_logger _ctx_log;
     config::binding<uint64_t> _max_concurrent_producer_ids;
+    config::binding<uint64_t> _max_evicted_producer_ids;
     mutex _clean_old_pids_mtx;
     ssx::metrics::metric_groups _metrics
       = ssx::metrics::metric_groups::make_internal();
@@ -523,6 +523,9 @@ void clear_partition_sizes(node_health_report& report) {
 
 ss::future<get_node_health_reply>
 service::do_collect_node_health_report(get_node_health_request req) {
+    if (req.incremental && req.filter == node_report_filter{}) {
+        co_return co_await do_collect_node_health_update(req.base_version);
+    }
     auto res = co_await _hm_frontend.local().collect_node_health(
       std::move(req.filter));
     if (res.has_error()) {
@@ -546,6 +549,23 @@ service::do_collect_node_health_report(get_node_health_request req) {
     };
 }
 
+ss::future<get_node_health_reply> service::do_collect_node_health_update(
+  std::optional<node_health_report_version> base) {
+    auto res = co_await _hm_frontend.local().collect_node_health_update(base);
+    if (res.has_error()) {
+        co_return get_node_health_reply{
+          .error = map_health_monitor_error_code(res.error())};
+    }
+    auto& update = res.value();
+    co_return get_node_health_reply{
+      .error = errc::success,
+      .report = std::move(update.report),
+      .report_version = update.version,
+      .delta_base = update.delta_base,
+      .removed_partitions = std::move(update.removed_partitions),
+    };
+}
+
 ss::future<get_cluster_health_reply>
 service::do_get_cluster_health_report(get_cluster_health_request req) {
     auto tout = config::shard_local_cfg().health_monitor_max_metadata_age()
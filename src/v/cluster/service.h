@@ -154,6 +154,9 @@ private:
     ss::future<get_node_health_reply>
       do_collect_node_health_report(get_node_health_request);
 
+    ss::future<get_node_health_reply>
+      do_collect_node_health_update(std::optional<node_health_report_version>);
+
     ss::future<get_cluster_health_reply>
       do_get_cluster_health_report(get_cluster_health_request);
 
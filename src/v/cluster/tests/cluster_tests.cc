@@ -7,14 +7,19 @@
 // the Business Source License, use of this software will be governed
 // by the Apache License, Version 2.0
 
+#include "cluster/controller.h"
 #include "cluster/metadata_cache.h"
+#include "cluster/partition_manager.h"
 #include "cluster/shard_table.h"
 #include "cluster/simple_batch_builder.h"
 #include "cluster/tests/cluster_test_fixture.h"
+#include "cluster/topics_frontend.h"
 #include "config/configuration.h"
 #include "features/feature_table_snapshot.h"
 #include "model/metadata.h"
+#include "model/timeout_clock.h"
 #include "net/unresolved_address.h"
+#include "test_utils/async.h"
 #include "test_utils/fixture.h"
 
 using namespace std::chrono_literals; // NOLINT
@@ -170,3 +175,54 @@ FIXTURE_TEST(test_feature_table_snapshots, cluster_test_fixture) {
       app->feature_table.local().is_active(features::feature::test_alpha)
       == true);
 }
+
+FIXTURE_TEST(
+  test_many_partitions_routable_on_all_shards, cluster_test_fixture) {
+    // The shard table updates of partitions reconciled at the same time are
+    // broadcast together, every one of them must still reach every shard.
+    model::node_id id{0};
+    auto app = create_node_application(id);
+    wait_for_controller_leadership(id).get();
+
+    auto check_topic = [app](model::topic topic, int partitions) {
+        std::vector<cluster::topic_configuration> topics;
+        topics.emplace_back(test_ns, topic, partitions, 1);
+        auto res = app->controller->get_topics_frontend()
+                     .local()
+                     .create_topics(
+                       cluster::without_custom_assignments(topics),
+                       10s + model::timeout_clock::now())
+                     .get();
+        BOOST_REQUIRE_EQUAL(res.size(), 1);
+        BOOST_REQUIRE_EQUAL(res[0].ec, cluster::errc::success);
+
+        for (int p = 0; p < partitions; ++p) {
+            model::ntp ntp(test_ns, topic, model::partition_id(p));
+            std::optional<ss::shard_id> shard;
+            tests::cooperative_spin_wait_with_timeout(10s, [&] {
+                shard = app->shard_table.local().shard_for(ntp);
+                if (!shard) {
+                    return ss::make_ready_future<bool>(false);
+                }
+                // every shard routes the ntp to the shard hosting it
+                return app->shard_table.map_reduce0(
+                  [&ntp, s = *shard](cluster::shard_table& st) {
+                      return st.shard_for(ntp) == s;
+                  },
+                  true,
+                  std::logical_and<>());
+            }).get();
+            tests::cooperative_spin_wait_with_timeout(10s, [&] {
+                return app->partition_manager.invoke_on(
+                  *shard, [&ntp](cluster::partition_manager& pm) {
+                      return pm.get(ntp) != nullptr;
+                  });
+            }).get();
+        }
+    };
+
+    // the second topic is reconciled after the batches of the first one are
+    // done with, its updates start new batches
+    check_topic(model::topic("many-partitions-1"), 64);
+    check_topic(model::topic("many-partitions-2"), 64);
+}
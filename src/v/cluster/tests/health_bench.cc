@@ -12,6 +12,8 @@
 #include "cluster/tests/health_monitor_test_utils.h"
 #include "model/namespace.h"
 #include "random/generators.h"
+#include "serde/serde.h"
+#include "units.h"
 #include "vassert.h"
 
 #include <seastar/testing/perf_tests.hh>
@@ -112,4 +114,114 @@ PERF_TEST_F(health_bench, original_unlimited) {
 
 PERF_TEST_F(health_bench, current) { bench(aggregate); }
 
+/**
+ * Cost of sending the report of a node hosting 100k partitions to the
+ * controller leader, in full or incrementally when 1% of the partitions
+ * changed since the previous report.
+ */
+struct health_report_serde_bench {
+    static constexpr int topic_count = 100;
+    static constexpr int parts_per_topic = 1000;
+    static constexpr int changed_every = 100;
+
+    static ss::chunked_fifo<topic_status> make_topics() {
+        ss::chunked_fifo<topic_status> topics;
+        for (int topic = 0; topic < topic_count; topic++) {
+            ss::chunked_fifo<partition_status> partitions;
+            for (int pid = 0; pid < parts_per_topic; pid++) {
+                partitions.push_back(partition_status{
+                  .id = model::partition_id(pid),
+                  .term = model::term_id(1),
+                  .leader_id = model::node_id(0),
+                  .revision_id = model::revision_id(topic),
+                  .size_bytes = random_generators::get_int<size_t>(1_GiB),
+                  .under_replicated_replicas = 0,
+                  .reclaimable_size_bytes = 0});
+            }
+            topics.emplace_back(
+              model::topic_namespace(
+                model::kafka_namespace,
+                model::topic(fmt::format("topic_{}", topic))),
+              std::move(partitions));
+        }
+        return topics;
+    }
+
+    static ss::chunked_fifo<topic_status>
+    copy_topics(const ss::chunked_fifo<topic_status>& topics) {
+        ss::chunked_fifo<topic_status> ret;
+        std::copy(topics.cbegin(), topics.cend(), std::back_inserter(ret));
+        return ret;
+    }
+
+    static get_node_health_reply
+    make_reply(ss::chunked_fifo<topic_status> topics) {
+        get_node_health_reply reply{.report = node_health_report{}};
+        reply.report->topics = std::move(topics);
+        return reply;
+    }
+
+    health_report_serde_bench()
+      : base(make_topics())
+      , current(copy_topics(base)) {
+        int i = 0;
+        for (auto& t : current) {
+            for (auto& p : t.partitions) {
+                if (i++ % changed_every == 0) {
+                    p.size_bytes += 1_MiB;
+                }
+            }
+        }
+        full = serde::to_iobuf(make_reply(copy_topics(current)));
+        auto delta = diff_topic_status(base, current);
+        auto reply = make_reply(std::move(delta.updated));
+        reply.removed_partitions = std::move(delta.removed);
+        incremental = serde::to_iobuf(std::move(reply));
+    }
+
+    ss::chunked_fifo<topic_status> base;
+    ss::chunked_fifo<topic_status> current;
+    iobuf full;
+    iobuf incremental;
+};
+
+PERF_TEST_F(health_report_serde_bench, full_encode) {
+    auto reply = make_reply(copy_topics(current));
+    perf_tests::start_measuring_time();
+    auto buf = serde::to_iobuf(std::move(reply));
+    perf_tests::stop_measuring_time();
+    perf_tests::do_not_optimize(buf.size_bytes());
+}
+
+PERF_TEST_F(health_report_serde_bench, full_decode) {
+    auto buf = full.copy();
+    perf_tests::start_measuring_time();
+    auto reply = serde::from_iobuf<get_node_health_reply>(std::move(buf));
+    perf_tests::stop_measuring_time();
+    perf_tests::do_not_optimize(reply.report->topics.size());
+}
+
+PERF_TEST_F(health_report_serde_bench, incremental_encode) {
+    perf_tests::start_measuring_time();
+    auto delta = diff_topic_status(base, current);
+    auto reply = make_reply(std::move(delta.updated));
+    reply.removed_partitions = std::move(delta.removed);
+    auto buf = serde::to_iobuf(std::move(reply));
+    perf_tests::stop_measuring_time();
+    perf_tests::do_not_optimize(buf.size_bytes());
+}
+
+PERF_TEST_F(health_report_serde_bench, incremental_decode) {
+    auto buf = incremental.copy();
+    perf_tests::start_measuring_time();
+    auto reply = serde::from_iobuf<get_node_health_reply>(std::move(buf));
+    auto topics = apply_topic_status_delta(
+      base,
+      topic_status_delta{
+        .updated = std::move(reply.report->topics),
+        .removed = std::move(reply.removed_partitions)});
+    perf_tests::stop_measuring_time();
+    perf_tests::do_not_optimize(topics.size());
+}
+
 } // namespace cluster
@@ -587,3 +587,59 @@ FIXTURE_TEST(test_report_truncation, health_report_unit) {
     test_unhealthy(max_count + 1, LEADERLESS);
     test_unhealthy(max_count + 1, URP);
 }
+
+namespace {
+absl::node_hash_map<model::ntp, partition_status>
+by_ntp(const ss::chunked_fifo<topic_status>& topics) {
+    absl::node_hash_map<model::ntp, partition_status> ret;
+    for (const auto& t : topics) {
+        for (const auto& p : t.partitions) {
+            ret.emplace(model::ntp(t.tp_ns.ns, t.tp_ns.tp, p.id), p);
+        }
+    }
+    return ret;
+}
+
+model::ntp kafka_ntp(ss::sstring topic_name, int32_t partition) {
+    return {
+      kafka_namespace,
+      model::topic(std::move(topic_name)),
+      model::partition_id(partition)};
+}
+
+ss::chunked_fifo<topic_status> make_topics(std::vector<topic_status> ts) {
+    ss::chunked_fifo<topic_status> topics;
+    std::move(ts.begin(), ts.end(), std::back_inserter(topics));
+    return topics;
+}
+} // namespace
+
+FIXTURE_TEST(test_incremental_report_delta, health_report_unit) {
+    auto base = make_topics(
+      {make_ts("topic_a", {HEALTHY, HEALTHY}), make_ts("topic_b", {HEALTHY})});
+    auto current = make_topics(
+      {make_ts("topic_a", {HEALTHY, URP, HEALTHY}),
+       make_ts("topic_c", {LEADERLESS})});
+
+    auto delta = diff_topic_status(base, current);
+
+    // only the changed and new partitions are sent
+    auto updated = by_ntp(delta.updated);
+    BOOST_REQUIRE_EQUAL(updated.size(), 3);
+    BOOST_REQUIRE(updated.contains(kafka_ntp("topic_a", 1)));
+    BOOST_REQUIRE(updated.contains(kafka_ntp("topic_a", 2)));
+    BOOST_REQUIRE(updated.contains(kafka_ntp("topic_c", 0)));
+    BOOST_REQUIRE_EQUAL(delta.removed.size(), 1);
+    BOOST_REQUIRE_EQUAL(delta.removed[0], kafka_ntp("topic_b", 0));
+
+    auto applied = apply_topic_status_delta(base, std::move(delta));
+    BOOST_REQUIRE(by_ntp(applied) == by_ntp(current));
+
+    // no changes, empty delta
+    auto unchanged = diff_topic_status(current, current);
+    BOOST_REQUIRE(unchanged.updated.empty());
+    BOOST_REQUIRE(unchanged.removed.empty());
+    BOOST_REQUIRE(
+      by_ntp(apply_topic_status_delta(current, std::move(unchanged)))
+      == by_ntp(current));
+}
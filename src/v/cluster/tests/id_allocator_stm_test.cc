@@ -39,9 +39,9 @@ using namespace std::chrono_literals;
 ss::logger idstmlog{"idstm-test"};
 
 struct id_allocator_stm_fixture : simple_raft_fixture {
-    void create_stm_and_start_raft() {
+    void create_stm_and_start_raft(int16_t batch_size = 1) {
         // set configuration parameters
-        test_local_cfg.get("id_allocator_batch_size").set_value(int16_t(1));
+        test_local_cfg.get("id_allocator_batch_size").set_value(batch_size);
         test_local_cfg.get("id_allocator_log_capacity").set_value(int16_t(2));
         create_raft();
         raft::state_machine_manager_builder stm_m_builder;
@@ -100,3 +100,21 @@ FIXTURE_TEST(stm_restart_test, id_allocator_stm_fixture) {
         last_id = result.id;
     }
 }
+
+FIXTURE_TEST(stm_range_allocation_test, id_allocator_stm_fixture) {
+    create_stm_and_start_raft(10);
+    wait_for_confirmed_leader();
+
+    // ranges are cut at batch boundaries
+    std::vector<int64_t> expected_counts{4, 4, 2, 4, 4, 2};
+    int64_t next_id = -1;
+    for (auto expected_count : expected_counts) {
+        auto result = _stm->allocate_id(1s, 4).get0();
+
+        BOOST_REQUIRE_EQUAL(raft::errc::success, result.raft_status);
+        BOOST_REQUIRE_EQUAL(expected_count, result.count);
+        BOOST_REQUIRE_LE(next_id, result.id);
+
+        next_id = result.id + result.count;
+    }
+}
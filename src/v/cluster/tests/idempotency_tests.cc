@@ -23,6 +23,7 @@
 #include "storage/record_batch_builder.h"
 #include "storage/tests/utils/disk_log_builder.h"
 #include "test_utils/async.h"
+#include "test_utils/scoped_config.h"
 
 #include <seastar/util/defer.hh>
 
@@ -381,3 +382,50 @@ FIXTURE_TEST(test_rm_stm_passes_immediate_retry, rm_stm_test_fixture) {
     BOOST_REQUIRE((bool)r2);
     BOOST_REQUIRE(r1.value().last_offset == r2.value().last_offset);
 }
+
+FIXTURE_TEST(test_rm_stm_reloads_evicted_producers, rm_stm_test_fixture) {
+    scoped_config cfg;
+    cfg.get("max_evicted_producer_ids").set_value(uint64_t(10));
+    max_concurrent_producer_ids = 1;
+    create_stm_and_start_raft();
+    auto& stm = *_stm;
+    stm.testing_only_disable_auto_abort();
+
+    stm.start().get0();
+
+    wait_for_confirmed_leader();
+    wait_for_meta_initialized();
+
+    auto count = 5;
+    auto replicate = [&](int64_t producer_id, int32_t base_sequence) {
+        auto rdr = random_batch_reader(model::test::record_batch_spec{
+          .offset = model::offset(0),
+          .allow_compression = true,
+          .count = count,
+          .producer_id = producer_id,
+          .base_sequence = base_sequence});
+        auto bid = model::batch_identity{
+          .pid = model::producer_identity{producer_id, 0},
+          .first_seq = base_sequence,
+          .last_seq = base_sequence + count - 1};
+        return stm
+          .replicate(
+            bid,
+            std::move(rdr),
+            raft::replicate_options(raft::consistency_level::quorum_ack))
+          .get0();
+    };
+
+    BOOST_REQUIRE((bool)replicate(1, 0));
+    BOOST_REQUIRE((bool)replicate(2, 0));
+
+    // the first producer is evicted from the seq table
+    tests::cooperative_spin_wait_with_timeout(5s, [&stm] {
+        return !stm.get_seq_number(model::producer_identity{1, 0});
+    }).get();
+
+    // but its sequence state survives in the evicted tier
+    BOOST_REQUIRE((bool)replicate(1, count));
+    BOOST_REQUIRE(
+      stm.get_seq_number(model::producer_identity{1, 0}) == 2 * count - 1);
+}
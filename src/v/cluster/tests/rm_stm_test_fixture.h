@@ -25,12 +25,14 @@ struct rm_stm_test_fixture : simple_raft_fixture {
           _raft.get(),
           tx_gateway_frontend,
           _feature_table,
-          config::mock_binding(std::numeric_limits<uint64_t>::max()));
+          config::mock_binding(max_concurrent_producer_ids));
 
         _raft->start(std::move(stm_m_builder)).get();
         _started = true;
     }
 
+    uint64_t max_concurrent_producer_ids{
+      std::numeric_limits<uint64_t>::max()};
     ss::sharded<cluster::tx_gateway_frontend> tx_gateway_frontend;
     ss::shared_ptr<cluster::rm_stm> _stm;
 };
@@ -1069,6 +1069,25 @@ SEASTAR_THREAD_TEST_CASE(serde_reflection_roundtrip) {
         cluster::abort_tx_reply data{random_tx_errc()};
         roundtrip_test(data);
     }
+    {
+        cluster::tx_markers_request data;
+        for (int i = 0; i < 3; ++i) {
+            data.markers.push_back(cluster::tx_marker{
+              .ntp = model::random_ntp(),
+              .pid = random_producer_identity(),
+              .tx_seq = tests::random_named_int<model::tx_seq>(),
+              .type = tests::random_bool()
+                        ? model::control_record_type::tx_commit
+                        : model::control_record_type::tx_abort,
+              .timeout = random_timeout_clock_duration()});
+        }
+        roundtrip_test(data);
+    }
+    {
+        cluster::tx_markers_reply data;
+        data.results = {random_tx_errc(), random_tx_errc()};
+        roundtrip_test(data);
+    }
     {
         cluster::begin_group_tx_request data{
           model::random_ntp(),
@@ -2376,3 +2395,46 @@ SEASTAR_THREAD_TEST_CASE(test_controller_snapshot_serde_no_forgotten_fields) {
     check_async_serde_no_forgotten_fields<
       cluster::controller_snapshot_parts::security_t>();
 }
+
+SEASTAR_THREAD_TEST_CASE(test_serialized_controller_snapshot_sections) {
+    using sections_t = cluster::serialized_controller_snapshot;
+    const auto cluster_uuid = model::cluster_uuid(uuid_t::create());
+    const auto next_id = tests::random_named_int<model::node_id>();
+    const auto config_version
+      = tests::random_named_int<cluster::config_version>();
+    const auto group_id = tests::random_named_int<raft::group_id>();
+    auto make_snapshot = [&] {
+        cluster::controller_snapshot snap;
+        snap.bootstrap.cluster_uuid = cluster_uuid;
+        snap.members.next_assigned_id = next_id;
+        snap.config.version = config_version;
+        snap.config.values.emplace("prop", "value");
+        snap.topics.highest_group_id = group_id;
+        return snap;
+    };
+
+    iobuf expected;
+    serde::write_async(expected, make_snapshot()).get();
+
+    // all sections serialized one by one
+    sections_t serialized;
+    serialized.serialize_missing(make_snapshot()).get();
+    auto topics = serialized.sections[sections_t::topics].copy();
+    iobuf actual;
+    serde::write_async(actual, std::move(serialized)).get();
+    BOOST_REQUIRE(actual == expected);
+
+    // the topics section is reused, it is not filled in the snapshot
+    auto without_topics = make_snapshot();
+    without_topics.topics = {};
+    sections_t reused;
+    reused.sections[sections_t::topics] = std::move(topics);
+    reused.serialize_missing(std::move(without_topics)).get();
+    iobuf reused_buf;
+    serde::write_async(reused_buf, std::move(reused)).get();
+    BOOST_REQUIRE(reused_buf == expected);
+
+    iobuf_parser parser(std::move(reused_buf));
+    auto read = serde::read_async<cluster::controller_snapshot>(parser).get();
+    BOOST_REQUIRE(read == make_snapshot());
+}
@@ -208,13 +208,13 @@ tm_stm::get_tx(kafka::transactional_id tx_id) {
     }
     auto tx_opt = _cache->find_mem(tx_id);
     if (tx_opt) {
-        co_return tx_opt.value();
+        co_return std::move(tx_opt.value());
     }
     tx_opt = _cache->find_log(tx_id);
     if (!tx_opt) {
         co_return tm_stm::op_status::not_found;
     }
-    co_return tx_opt.value();
+    co_return std::move(tx_opt.value());
 }
 
 ss::future<checked<model::term_id, tm_stm::op_status>> tm_stm::barrier() {
@@ -475,7 +475,7 @@ ss::future<checked<tm_transaction, tm_stm::op_status>> tm_stm::mark_tx_aborting(
     if (!ptx.has_value()) {
         co_return ptx;
     }
-    auto tx = ptx.value();
+    auto tx = std::move(ptx.value());
     if (tx.status != tm_transaction::tx_status::ongoing) {
         co_return tm_stm::op_status::conflict;
     }
@@ -495,7 +495,7 @@ ss::future<checked<tm_transaction, tm_stm::op_status>> tm_stm::mark_tx_prepared(
           tx_id);
         co_return tx_opt;
     }
-    auto tx = tx_opt.value();
+    auto tx = std::move(tx_opt.value());
 
     auto check_status = is_transaction_ga()
                           ? tm_transaction::tx_status::ongoing
@@ -522,7 +522,7 @@ ss::future<checked<tm_transaction, tm_stm::op_status>> tm_stm::mark_tx_killed(
     if (!tx_opt.has_value()) {
         co_return tx_opt;
     }
-    auto tx = tx_opt.value();
+    auto tx = std::move(tx_opt.value());
     if (
       tx.status != tm_transaction::tx_status::ongoing
       && tx.status != tm_transaction::tx_status::preparing) {
@@ -539,7 +539,7 @@ tm_stm::reset_transferring(model::term_id term, kafka::transactional_id tx_id) {
     if (!ptx.has_value()) {
         co_return ptx;
     }
-    auto tx = ptx.value();
+    auto tx = std::move(ptx.value());
     // Check if transferring.
     if (!tx.transferring) {
         co_return tm_stm::op_status::conflict;
@@ -567,7 +567,7 @@ tm_stm::reset_transferring(model::term_id term, kafka::transactional_id tx_id) {
     if (!r.has_value()) {
         co_return r;
     }
-    tx = r.value();
+    tx = std::move(r.value());
     _cache->set_mem(tx.etag, tx_id, tx);
     co_return tx;
 }
@@ -578,7 +578,7 @@ ss::future<checked<tm_transaction, tm_stm::op_status>> tm_stm::mark_tx_ongoing(
     if (!tx_opt.has_value()) {
         co_return tx_opt;
     }
-    tm_transaction tx = tx_opt.value();
+    tm_transaction tx = std::move(tx_opt.value());
     if (tx.etag != expected_term) {
         vlog(
           txlog.warn,
@@ -612,7 +612,7 @@ ss::future<tm_stm::op_status> tm_stm::re_register_producer(
     if (!tx_opt.has_value()) {
         co_return tx_opt.error();
     }
-    tm_transaction tx = tx_opt.value();
+    tm_transaction tx = std::move(tx_opt.value());
     tx.status = tm_transaction::tx_status::ready;
     tx.pid = pid;
     tx.last_pid = last_pid;
@@ -702,7 +702,7 @@ ss::future<tm_stm::op_status> tm_stm::add_partitions(
         vlog(txlog.warn, "An ongoing transaction tx:{} isn't found", tx_id);
         co_return tm_stm::op_status::unknown;
     }
-    auto tx = tx_opt.value();
+    auto tx = std::move(tx_opt.value());
     if (tx.status != tm_transaction::tx_status::ongoing) {
         vlog(
           txlog.warn,
@@ -765,7 +765,7 @@ ss::future<tm_stm::op_status> tm_stm::add_group(
         vlog(txlog.warn, "An ongoing transaction tx:{} isn't found", tx_id);
         co_return tm_stm::op_status::unknown;
     }
-    auto tx = tx_opt.value();
+    auto tx = std::move(tx_opt.value());
     if (tx.status != tm_transaction::tx_status::ongoing) {
         vlog(
           txlog.warn,
@@ -982,7 +982,7 @@ tm_stm::apply_tm_update(model::record_batch_header hdr, model::record_batch b) {
 
     auto tx_opt = _cache->find_mem(tx.id);
     if (tx_opt) {
-        auto old_tx = tx_opt.value();
+        const auto& old_tx = tx_opt.value();
         if (
           (old_tx.etag < tx.etag)
           || (old_tx.etag == tx.etag && old_tx.tx_seq <= tx.tx_seq)) {
@@ -1117,7 +1117,7 @@ tm_stm::delete_partition_from_tx(
         co_return optional_tx;
     }
 
-    auto tx = optional_tx.value();
+    auto tx = std::move(optional_tx.value());
 
     auto res = tx.delete_partition(ntp);
     if (!res) {
@@ -1138,7 +1138,7 @@ tm_stm::expire_tx(model::term_id term, kafka::transactional_id tx_id) {
     if (!tx_opt.has_value()) {
         co_return tm_stm::op_status::unknown;
     }
-    tm_transaction tx = tx_opt.value();
+    tm_transaction tx = std::move(tx_opt.value());
     tx.etag = term;
     tx.status = tm_transaction::tx_status::tombstone;
     tx.last_pid = model::unknown_pid;
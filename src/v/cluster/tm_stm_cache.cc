@@ -95,31 +95,51 @@ tm_stm_cache::find(model::term_id term, kafka::transactional_id tx_id) {
     return log_it->second.tx;
 }
 
-std::optional<tm_transaction>
-tm_stm_cache::find_mem(kafka::transactional_id tx_id) {
+const tm_transaction*
+tm_stm_cache::lookup_mem(const kafka::transactional_id& tx_id) const {
     if (_mem_term == std::nullopt) {
-        return std::nullopt;
+        return nullptr;
     }
     auto term = _mem_term.value();
     auto entry_it = _state.find(term);
     if (entry_it == _state.end()) {
-        return std::nullopt;
+        return nullptr;
     }
-    auto& entry = entry_it->second;
+    const auto& entry = entry_it->second;
     auto tx_it = entry.txes.find(tx_id);
     if (tx_it == entry.txes.end()) {
-        return std::nullopt;
+        return nullptr;
     }
-    return tx_it->second;
+    return &tx_it->second;
 }
 
-std::optional<tm_transaction>
-tm_stm_cache::find_log(kafka::transactional_id tx_id) {
+const tm_transaction*
+tm_stm_cache::lookup_log(const kafka::transactional_id& tx_id) const {
     auto tx_it = _log_txes.find(tx_id);
     if (tx_it == _log_txes.end()) {
-        return std::nullopt;
+        return nullptr;
     }
-    return tx_it->second.tx;
+    return &tx_it->second.tx;
+}
+
+std::optional<tm_transaction>
+tm_stm_cache::find_mem(const kafka::transactional_id& tx_id) const {
+    if (const auto* tx = lookup_mem(tx_id)) {
+        return *tx;
+    }
+    return std::nullopt;
+}
+
+std::optional<tm_transaction>
+tm_stm_cache::find_log(const kafka::transactional_id& tx_id) const {
+    if (const auto* tx = lookup_log(tx_id)) {
+        return *tx;
+    }
+    return std::nullopt;
+}
+
+bool tm_stm_cache::contains(const kafka::transactional_id& tx_id) const {
+    return lookup_mem(tx_id) != nullptr || lookup_log(tx_id) != nullptr;
 }
 
 void tm_stm_cache::set_log(tm_transaction tx) {
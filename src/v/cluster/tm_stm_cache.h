@@ -195,9 +195,14 @@ public:
 
     std::optional<tm_transaction> find(model::term_id, kafka::transactional_id);
 
-    std::optional<tm_transaction> find_mem(kafka::transactional_id tx_id);
+    std::optional<tm_transaction>
+    find_mem(const kafka::transactional_id& tx_id) const;
 
-    std::optional<tm_transaction> find_log(kafka::transactional_id tx_id);
+    std::optional<tm_transaction>
+    find_log(const kafka::transactional_id& tx_id) const;
+
+    // Checks whether a tx is known without copying it out of the cache
+    bool contains(const kafka::transactional_id& tx_id) const;
 
     void set_log(tm_transaction);
     // It is important that we unlink entries from _log_txes before
@@ -244,6 +249,10 @@ public:
     size_t tx_cache_size() const;
 
 private:
+    const tm_transaction* lookup_mem(const kafka::transactional_id&) const;
+
+    const tm_transaction* lookup_log(const kafka::transactional_id&) const;
+
     struct tx_wrapper {
         tx_wrapper() = default;
 
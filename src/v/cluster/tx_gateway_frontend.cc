@@ -502,7 +502,7 @@ ss::future<fetch_tx_reply> tx_gateway_frontend::fetch_tx_locally(
     if (!tx_opt) {
         co_return fetch_tx_reply(tx_errc::tx_not_found);
     }
-    auto tx = tx_opt.value();
+    auto tx = std::move(tx_opt.value());
 
     fetch_tx_reply reply;
     reply.ec = tx_errc::none;
@@ -797,7 +797,7 @@ ss::future<try_abort_reply> tx_gateway_frontend::do_try_abort(
         }
     }
 
-    auto tx = tx_opt.value();
+    auto tx = std::move(tx_opt.value());
 
     if (tx.transferring) {
         tx_opt = co_await stm->reset_transferring(term, tx_id);
@@ -810,7 +810,7 @@ ss::future<try_abort_reply> tx_gateway_frontend::do_try_abort(
             // any error on lookin up a tx is a retriable error
             co_return try_abort_reply{tx_errc::not_coordinator};
         }
-        tx = tx_opt.value();
+        tx = std::move(tx_opt.value());
     }
 
     if (tx.etag > term) {
@@ -1156,7 +1156,7 @@ ss::future<cluster::init_tm_tx_reply> tx_gateway_frontend::limit_init_tm_tx(
                 co_return init_tm_tx_reply{tx_errc::not_coordinator};
             }
 
-            auto tx = tx_opt.value();
+            auto tx = std::move(tx_opt.value());
             vlog(
               txlog.info,
               "tx cache is at capacity; expiring oldest tx with id:{}",
@@ -1249,7 +1249,7 @@ ss::future<cluster::init_tm_tx_reply> tx_gateway_frontend::do_init_tm_tx(
         }
         co_return reply;
     }
-    auto tx = r0.value();
+    auto tx = std::move(r0.value());
 
     if (!is_valid_producer(tx, expected_pid)) {
         co_return init_tm_tx_reply{tx_errc::invalid_producer_epoch};
@@ -1275,7 +1275,7 @@ ss::future<cluster::init_tm_tx_reply> tx_gateway_frontend::do_init_tm_tx(
         co_return init_tm_tx_reply{r.error()};
     }
 
-    tx = r.value();
+    tx = std::move(r.value());
     init_tm_tx_reply reply;
     model::producer_identity last_pid = model::unknown_pid;
 
@@ -1419,7 +1419,7 @@ ss::future<add_paritions_tx_reply> tx_gateway_frontend::do_add_partition_to_tx(
           pid);
         co_return make_add_partitions_error_response(request, r.error());
     }
-    auto tx = r.value();
+    auto tx = std::move(r.value());
 
     add_paritions_tx_reply response;
 
@@ -1637,7 +1637,7 @@ ss::future<add_offsets_tx_reply> tx_gateway_frontend::do_add_offsets_to_tx(
           request.transactional_id);
         co_return add_offsets_tx_reply{.error_code = r.error()};
     }
-    auto tx = r.value();
+    auto tx = std::move(r.value());
 
     auto group_info = co_await _rm_group_proxy->begin_group_tx(
       request.group_id, pid, tx.tx_seq, tx.timeout_ms, stm->get_partition());
@@ -1839,7 +1839,7 @@ tx_gateway_frontend::do_end_txn(
         outcome->set_value(err);
         co_return err;
     }
-    auto tx = r0.value();
+    auto tx = std::move(r0.value());
 
     checked<cluster::tm_transaction, tx_errc> r(tx_errc::unknown_server_error);
     if (request.committed) {
@@ -1937,7 +1937,7 @@ tx_gateway_frontend::do_end_txn(
     if (!r.has_value()) {
         co_return r;
     }
-    tx = r.value();
+    tx = std::move(r.value());
 
     auto ongoing_tx = co_await stm->mark_tx_ongoing(term, tx.id);
     if (!ongoing_tx.has_value()) {
@@ -2489,7 +2489,7 @@ ss::future<checked<tm_transaction, tx_errc>> tx_gateway_frontend::get_tx(
         }
     }
 
-    auto tx = tx_opt.value();
+    auto tx = std::move(tx_opt.value());
 
     if (tx.transferring) {
         tx_opt = co_await stm->reset_transferring(term, tid);
@@ -2502,7 +2502,7 @@ ss::future<checked<tm_transaction, tx_errc>> tx_gateway_frontend::get_tx(
             // any error on lookin up a tx is a retriable error
             co_return tx_errc::not_coordinator;
         }
-        tx = tx_opt.value();
+        tx = std::move(tx_opt.value());
     }
 
     if (term == tx.etag) {
@@ -2815,7 +2815,7 @@ ss::future<checked<tm_transaction, tx_errc>> tx_gateway_frontend::get_latest_tx(
         co_return r0.error();
     }
 
-    auto tx = r0.value();
+    auto tx = std::move(r0.value());
 
     if (term != tx.etag) {
         // very unlikely situation happens only when !is_fetch_tx_supported()
@@ -2858,7 +2858,7 @@ tx_gateway_frontend::get_ongoing_tx(
         }
         co_return r0.error();
     }
-    auto tx = r0.value();
+    auto tx = std::move(r0.value());
 
     if (tx.status == tm_transaction::tx_status::ongoing) {
         co_return tx;
@@ -3024,7 +3024,7 @@ ss::future<tx_errc> tx_gateway_frontend::do_expire_old_tx(
         // either timeout or already expired
         co_return tx_errc::tx_not_found;
     }
-    auto tx = r0.value();
+    auto tx = std::move(r0.value());
     if (!ignore_update_ts && !stm->is_expired(tx)) {
         co_return tx_errc::none;
     }
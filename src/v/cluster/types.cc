@@ -910,6 +910,28 @@ std::ostream& operator<<(std::ostream& o, const abort_tx_reply& r) {
     return o;
 }
 
+std::ostream& operator<<(std::ostream& o, const tx_marker& r) {
+    fmt::print(
+      o,
+      "{{ntp {} pid {} tx_seq {} commit {} timeout {}}}",
+      r.ntp,
+      r.pid,
+      r.tx_seq,
+      r.type == model::control_record_type::tx_commit,
+      r.timeout);
+    return o;
+}
+
+std::ostream& operator<<(std::ostream& o, const tx_markers_request& r) {
+    fmt::print(o, "{{markers {}}}", r.markers);
+    return o;
+}
+
+std::ostream& operator<<(std::ostream& o, const tx_markers_reply& r) {
+    fmt::print(o, "{{results {}}}", r.results);
+    return o;
+}
+
 std::ostream& operator<<(std::ostream& o, const begin_group_tx_request& r) {
     fmt::print(
       o,
@@ -63,14 +63,18 @@ constexpr cluster_version invalid_version = cluster_version{-1};
 struct allocate_id_request
   : serde::envelope<
       allocate_id_request,
-      serde::version<0>,
+      serde::version<1>,
       serde::compat_version<0>> {
     model::timeout_clock::duration timeout;
+    // number of consecutive ids requested, the allocator may grant fewer
+    int64_t count{1};
 
     allocate_id_request() noexcept = default;
 
-    explicit allocate_id_request(model::timeout_clock::duration timeout)
-      : timeout(timeout) {}
+    explicit allocate_id_request(
+      model::timeout_clock::duration timeout, int64_t count = 1)
+      : timeout(timeout)
+      , count(count) {}
 
     friend bool
     operator==(const allocate_id_request&, const allocate_id_request&)
@@ -78,35 +82,39 @@ struct allocate_id_request
 
     friend std::ostream&
     operator<<(std::ostream& o, const allocate_id_request& req) {
-        fmt::print(o, "timeout: {}", req.timeout.count());
+        fmt::print(o, "timeout: {}, count: {}", req.timeout.count(), req.count);
         return o;
     }
 
-    auto serde_fields() { return std::tie(timeout); }
+    auto serde_fields() { return std::tie(timeout, count); }
 };
 
 struct allocate_id_reply
   : serde::
-      envelope<allocate_id_reply, serde::version<0>, serde::compat_version<0>> {
+      envelope<allocate_id_reply, serde::version<1>, serde::compat_version<0>> {
     int64_t id;
     errc ec;
+    // number of consecutive ids granted, starting with id. Allocators
+    // predating ranges always grant a single one.
+    int64_t count{1};
 
     allocate_id_reply() noexcept = default;
 
-    allocate_id_reply(int64_t id, errc ec)
+    allocate_id_reply(int64_t id, errc ec, int64_t count = 1)
       : id(id)
-      , ec(ec) {}
+      , ec(ec)
+      , count(count) {}
 
     friend bool operator==(const allocate_id_reply&, const allocate_id_reply&)
       = default;
 
     friend std::ostream&
     operator<<(std::ostream& o, const allocate_id_reply& rep) {
-        fmt::print(o, "id: {}, ec: {}", rep.id, rep.ec);
+        fmt::print(o, "id: {}, ec: {}, count: {}", rep.id, rep.ec, rep.count);
         return o;
     }
 
-    auto serde_fields() { return std::tie(id, ec); }
+    auto serde_fields() { return std::tie(id, ec, count); }
 };
 
 enum class tx_errc {
@@ -698,6 +706,55 @@ struct abort_tx_reply
     friend std::ostream& operator<<(std::ostream& o, const abort_tx_reply& r);
 };
 
+/// A commit or an abort marker for a transaction on a data partition
+struct tx_marker
+  : serde::envelope<tx_marker, serde::version<0>, serde::compat_version<0>> {
+    model::ntp ntp;
+    model::producer_identity pid;
+    model::tx_seq tx_seq;
+    model::control_record_type type{model::control_record_type::unknown};
+    model::timeout_clock::duration timeout{};
+
+    friend bool operator==(const tx_marker&, const tx_marker&) = default;
+
+    auto serde_fields() { return std::tie(ntp, pid, tx_seq, type, timeout); }
+
+    friend std::ostream& operator<<(std::ostream& o, const tx_marker& r);
+};
+
+/// Markers of any number of transactions whose partitions are all led by the
+/// receiving node.
+struct tx_markers_request
+  : serde::envelope<
+      tx_markers_request,
+      serde::version<0>,
+      serde::compat_version<0>> {
+    std::vector<tx_marker> markers;
+
+    friend bool
+    operator==(const tx_markers_request&, const tx_markers_request&)
+      = default;
+
+    auto serde_fields() { return std::tie(markers); }
+
+    friend std::ostream&
+    operator<<(std::ostream& o, const tx_markers_request& r);
+};
+
+/// Results of a tx_markers_request, in the order of its markers
+struct tx_markers_reply
+  : serde::
+      envelope<tx_markers_reply, serde::version<0>, serde::compat_version<0>> {
+    std::vector<tx_errc> results;
+
+    friend bool operator==(const tx_markers_reply&, const tx_markers_reply&)
+      = default;
+
+    auto serde_fields() { return std::tie(results); }
+
+    friend std::ostream& operator<<(std::ostream& o, const tx_markers_reply& r);
+};
+
 struct begin_group_tx_request
   : serde::envelope<
       begin_group_tx_request,
@@ -4017,6 +4074,8 @@ static const ss::sstring rm_stm_snapshot = "tx.snapshot";
 static const ss::sstring tm_stm_snapshot = "tx.coordinator.snapshot";
 static const ss::sstring id_allocator_snapshot = "id.snapshot";
 static const ss::sstring tx_registry_snapshot = "tx_registry.snapshot";
+/// Not an stm, consumer group state snapshotted by kafka::group_manager
+static const ss::sstring group_state_snapshot = "group_state.snapshot";
 
 /**
  * Create/update a (Wasm) plugin.
@@ -29,7 +29,8 @@ template<>
 struct instance_generator<cluster::allocate_id_request> {
     static cluster::allocate_id_request random() {
         return cluster::allocate_id_request{
-          tests::random_duration<model::timeout_clock::duration>()};
+          tests::random_duration<model::timeout_clock::duration>(),
+          random_generators::get_int<int64_t>(1, 1000)};
     }
 
     static std::vector<cluster::allocate_id_request> limits() {
@@ -56,7 +57,8 @@ struct instance_generator<cluster::allocate_id_reply> {
           errc_min, errc_max);
         return {
           random_generators::get_int<int64_t>(int64_min, int64_max),
-          cluster::errc(errc_rand)};
+          cluster::errc(errc_rand),
+          random_generators::get_int<int64_t>(1, 1000)};
     }
 
     static std::vector<cluster::allocate_id_reply> limits() {
@@ -412,6 +412,23 @@ configuration::configuration()
       "How often the system should check for expired group offsets.",
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       10min)
+  , group_offset_commit_linger_ms(
+      *this,
+      "group_offset_commit_linger_ms",
+      "How long offset commits wait to be coalesced with the commits of other "
+      "groups on the same consumer offsets partition into a single batch. "
+      "Set to 0 to replicate each offset commit as its own batch.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      0ms)
+  , group_state_snapshot_interval_ms(
+      *this,
+      "group_state_snapshot_interval_ms",
+      "How often each broker snapshots the group state of its consumer "
+      "offsets partitions. Group recovery after a leadership change then only "
+      "replays the part of the log written after the snapshot. Set to 0 to "
+      "disable snapshots and always replay the whole log.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      0ms)
   , legacy_group_offset_retention_enabled(
       *this,
       "legacy_group_offset_retention_enabled",
@@ -471,6 +488,14 @@ configuration::configuration()
       "Delay before scheduling next check for timed out transactions",
       {.visibility = visibility::user},
       1000ms)
+  , tx_marker_linger_ms(
+      *this,
+      "tx_marker_linger_ms",
+      "Time a transaction coordinator waits to coalesce the commit and abort "
+      "markers bound to the same node into a single request. Zero sends each "
+      "marker on its own",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      0ms)
   , rm_violation_recovery_policy(*this, "rm_violation_recovery_policy")
   , fetch_reads_debounce_timeout(
       *this,
@@ -620,6 +645,16 @@ configuration::configuration()
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       std::numeric_limits<uint64_t>::max(),
       {.min = 1})
+  , max_evicted_producer_ids(
+      *this,
+      "max_evicted_producer_ids",
+      "Max number of idle producers per partition whose sequence state is "
+      "kept in compact form after they are terminated because of "
+      "max_concurrent_producer_ids. Such a producer resumes its session "
+      "when it produces again instead of having its batches rejected. 0 "
+      "disables keeping terminated producers.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      0)
   , max_transactions_per_coordinator(
       *this,
       "max_transactions_per_coordinator",
@@ -1048,6 +1083,15 @@ configuration::configuration()
       "touching the log until the batch is exhausted.",
       {.visibility = visibility::tunable},
       1000)
+  , id_allocator_lease_size(
+      *this,
+      "id_allocator_lease_size",
+      "Number of ids each shard leases from the id allocator at once and then "
+      "serves locally, e.g. producer ids for idempotent producers. A value of "
+      "1 disables leasing, every id is requested from the id allocator.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      1,
+      {.min = 1})
   , enable_sasl(
       *this,
       "enable_sasl",
@@ -1117,6 +1161,14 @@ configuration::configuration()
       "Interval between iterations of controller backend housekeeping loop",
       {.visibility = visibility::tunable},
       1s)
+  , controller_backend_reconciliation_concurrency(
+      *this,
+      "controller_backend_reconciliation_concurrency",
+      "How many partitions each shard may reconcile at a time, bounds the disk "
+      "I/O of creating the partitions of new topics",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      1024,
+      {.min = 1, .max = 16384})
   , node_management_operation_timeout_ms(
       *this,
       "node_management_operation_timeout_ms",
@@ -1435,6 +1487,16 @@ configuration::configuration()
       "metadata will be updated after each segment upload.",
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       60s)
+  , cloud_storage_manifest_delta_segments(
+      *this,
+      "cloud_storage_manifest_delta_segments",
+      "When a partition manifest only changed by new segments since its last "
+      "full upload, upload a delta object with those segments instead, until "
+      "it holds this many segments. Readers merge the delta into the manifest "
+      "only if this is non-zero, so clusters reading this cluster's bucket, "
+      "e.g. read replicas, need it set too. Zero disables delta uploads.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      0)
   , cloud_storage_readreplica_manifest_sync_timeout_ms(
       *this,
       "cloud_storage_readreplica_manifest_sync_timeout_ms",
@@ -1954,6 +2016,28 @@ configuration::configuration()
       "are downloaded.",
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       false)
+  , cloud_storage_segment_index_min_size(
+      *this,
+      "cloud_storage_segment_index_min_size",
+      "Segments smaller than this are uploaded without a separate index "
+      "object. The manifest marks them so that readers download them whole, "
+      "as in legacy mode. Low throughput partitions then write one object "
+      "per segment instead of two, and read it back with a single request. "
+      "If zero, an index is uploaded for every segment. Only enable once "
+      "every cluster reading the bucket, including read replicas, runs a "
+      "version that can read such segments.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      0)
+  , cloud_storage_compress_small_segments(
+      *this,
+      "cloud_storage_compress_small_segments",
+      "Compress segments smaller than cloud_storage_segment_index_min_size "
+      "with zstd before uploading them. Segments are uncompressed on "
+      "download, clients never see the object compression. Only enable once "
+      "every cluster reading the bucket, including read replicas, runs a "
+      "version that can read compressed segments.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      false)
   , cloud_storage_chunk_eviction_strategy(
       *this,
       "cloud_storage_chunk_eviction_strategy",
@@ -2192,6 +2276,14 @@ configuration::configuration()
       "Max age of metadata cached in the health monitor of non controller node",
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       10s)
+  , health_monitor_incremental_reports(
+      *this,
+      "health_monitor_incremental_reports",
+      "When collecting node health reports, the controller leader only asks "
+      "nodes for the partitions whose status changed since their previous "
+      "report",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      false)
   , storage_space_alert_free_threshold_percent(
       *this,
       "storage_space_alert_free_threshold_percent",
@@ -2458,6 +2550,24 @@ configuration::configuration()
       "controller snapshot, after a new controller command appears",
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       60s)
+  , stm_snapshot_max_age_sec(
+      *this,
+      "stm_snapshot_max_age_sec",
+      "Max time that will pass before we make an attempt to create a local "
+      "snapshot of a partition state machine, after new entries were applied "
+      "to it. Snapshots are also taken whenever enough bytes were written to "
+      "the partition. If unset only the latter applies",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      3600s)
+  , stm_apply_timeout_ms(
+      *this,
+      "stm_apply_timeout_ms",
+      "Time a partition state machine may take to apply a batch before the "
+      "other state machines of the partition stop waiting for it. The slow "
+      "state machine then catches up in a fiber of its own. Set to 0 to "
+      "always wait for every state machine.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      0ms)
   , legacy_permit_unsafe_log_operation(
       *this,
       "legacy_permit_unsafe_log_operation",
@@ -2486,6 +2596,13 @@ configuration::configuration()
       "Per-shard capacity of the cache for validating schema IDs.",
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       128)
+  , schema_registry_parsed_schema_cache_bytes(
+      *this,
+      "schema_registry_parsed_schema_cache_bytes",
+      "Per-shard size, by schema definition size, of the Schema Registry "
+      "cache of parsed schemas used for compatibility checks.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      16_MiB)
   , kafka_memory_share_for_fetch(
       *this,
       "kafka_memory_share_for_fetch",
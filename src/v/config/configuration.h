@@ -111,6 +111,8 @@ struct configuration final : public config_store {
     property<std::optional<std::chrono::seconds>> group_offset_retention_sec;
     property<std::chrono::milliseconds> group_offset_retention_check_ms;
     property<bool> legacy_group_offset_retention_enabled;
+    property<std::chrono::milliseconds> group_offset_commit_linger_ms;
+    property<std::chrono::milliseconds> group_state_snapshot_interval_ms;
     property<std::chrono::milliseconds> metadata_dissemination_interval_ms;
     property<std::chrono::milliseconds> metadata_dissemination_retry_delay_ms;
     property<int16_t> metadata_dissemination_retries;
@@ -121,6 +123,7 @@ struct configuration final : public config_store {
     property<std::chrono::milliseconds> find_coordinator_timeout_ms;
     deprecated_property seq_table_min_size;
     property<std::chrono::milliseconds> tx_timeout_delay_ms;
+    property<std::chrono::milliseconds> tx_marker_linger_ms;
     deprecated_property rm_violation_recovery_policy;
     property<std::chrono::milliseconds> fetch_reads_debounce_timeout;
     property<std::chrono::milliseconds> alter_topic_cfg_timeout_ms;
@@ -142,6 +145,7 @@ struct configuration final : public config_store {
     // same as transactional.id.expiration.ms in kafka
     property<std::chrono::milliseconds> transactional_id_expiration_ms;
     bounded_property<uint64_t> max_concurrent_producer_ids;
+    property<uint64_t> max_evicted_producer_ids;
     bounded_property<uint64_t> max_transactions_per_coordinator;
     property<bool> enable_idempotence;
     property<bool> enable_transactions;
@@ -214,6 +218,7 @@ struct configuration final : public config_store {
     property<int16_t> tx_registry_log_capacity;
     property<int16_t> id_allocator_log_capacity;
     property<int16_t> id_allocator_batch_size;
+    bounded_property<int16_t> id_allocator_lease_size;
     property<bool> enable_sasl;
     property<std::vector<ss::sstring>> sasl_mechanisms;
     property<ss::sstring> sasl_kerberos_config;
@@ -226,6 +231,7 @@ struct configuration final : public config_store {
     property<bool> kafka_enable_partition_reassignment;
     property<std::chrono::milliseconds>
       controller_backend_housekeeping_interval_ms;
+    bounded_property<size_t> controller_backend_reconciliation_concurrency;
     property<std::chrono::milliseconds> node_management_operation_timeout_ms;
     property<uint32_t> kafka_request_max_bytes;
     property<uint32_t> kafka_batch_max_bytes;
@@ -285,6 +291,7 @@ struct configuration final : public config_store {
       cloud_storage_segment_max_upload_interval_sec;
     property<std::optional<std::chrono::seconds>>
       cloud_storage_manifest_max_upload_interval_sec;
+    property<size_t> cloud_storage_manifest_delta_segments;
     property<std::chrono::milliseconds>
       cloud_storage_readreplica_manifest_sync_timeout_ms;
     property<std::chrono::milliseconds> cloud_storage_metadata_sync_timeout_ms;
@@ -368,6 +375,8 @@ struct configuration final : public config_store {
     property<double> cloud_storage_hydrated_chunks_per_segment_ratio;
     property<uint64_t> cloud_storage_min_chunks_per_segment_threshold;
     property<bool> cloud_storage_disable_chunk_reads;
+    property<uint64_t> cloud_storage_segment_index_min_size;
+    property<bool> cloud_storage_compress_small_segments;
     enum_property<model::cloud_storage_chunk_eviction_strategy>
       cloud_storage_chunk_eviction_strategy;
     property<uint16_t> cloud_storage_chunk_prefetch;
@@ -415,6 +424,7 @@ struct configuration final : public config_store {
     // health monitor
     property<std::chrono::milliseconds> health_monitor_tick_interval;
     property<std::chrono::milliseconds> health_monitor_max_metadata_age;
+    property<bool> health_monitor_incremental_reports;
     bounded_property<unsigned> storage_space_alert_free_threshold_percent;
     bounded_property<size_t> storage_space_alert_free_threshold_bytes;
     bounded_property<size_t> storage_min_free_bytes;
@@ -470,6 +480,8 @@ struct configuration final : public config_store {
     bounded_property<int64_t> node_isolation_heartbeat_timeout;
 
     property<std::chrono::seconds> controller_snapshot_max_age_sec;
+    property<std::optional<std::chrono::seconds>> stm_snapshot_max_age_sec;
+    property<std::chrono::milliseconds> stm_apply_timeout_ms;
     // security controls
     property<bool> legacy_permit_unsafe_log_operation;
     property<std::chrono::seconds> legacy_unsafe_log_warning_interval_sec;
@@ -478,6 +490,7 @@ struct configuration final : public config_store {
     enum_property<pandaproxy::schema_registry::schema_id_validation_mode>
       enable_schema_id_validation;
     config::property<size_t> kafka_schema_id_validation_cache_capacity;
+    config::property<size_t> schema_registry_parsed_schema_cache_bytes;
 
     bounded_property<double, numeric_bounds> kafka_memory_share_for_fetch;
     property<size_t> kafka_memory_batch_size_estimate_for_fetch;
@@ -79,6 +79,10 @@ std::string_view to_string_view(feature f) {
         return "raft_coordinated_recovery";
     case feature::cloud_storage_scrubbing:
         return "cloud_storage_scrubbing";
+    case feature::coalesced_tx_markers:
+        return "coalesced_tx_markers";
+    case feature::cloud_storage_unindexed_segments:
+        return "cloud_storage_unindexed_segments";
 
     /*
      * testing features
@@ -124,12 +128,13 @@ std::string_view to_string_view(feature_state::state s) {
 //  23.1.1 -> 9
 //  23.2.1 -> 10
 //  23.3.1 -> 11
+//  24.1.1 -> 12
 //
 // Although some previous stable branches have included feature version
 // bumps, this is _not_ the intended usage, as stable branches are
 // meant to be safely downgradable within the branch, and new features
 // imply that new data formats may be written.
-static constexpr cluster_version latest_version = cluster_version{11};
+static constexpr cluster_version latest_version = cluster_version{12};
 
 // The earliest version we can upgrade from.  This is the version that
 // a freshly initialized node will start at: e.g. a 23.1 Redpanda joining
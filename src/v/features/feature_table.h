@@ -64,6 +64,8 @@ enum class feature : std::uint64_t {
     lightweight_heartbeats = 1ULL << 30U,
     raft_coordinated_recovery = 1ULL << 31U,
     cloud_storage_scrubbing = 1ULL << 32U,
+    coalesced_tx_markers = 1ULL << 33U,
+    cloud_storage_unindexed_segments = 1ULL << 34U,
 
     // Dummy features for testing only
     test_alpha = 1ULL << 61U,
@@ -299,6 +301,18 @@ constexpr static std::array feature_schema{
     "cloud_storage_scrubbing",
     feature::cloud_storage_scrubbing,
     feature_spec::available_policy::always,
+    feature_spec::prepare_policy::always},
+  feature_spec{
+    cluster::cluster_version{12},
+    "coalesced_tx_markers",
+    feature::coalesced_tx_markers,
+    feature_spec::available_policy::always,
+    feature_spec::prepare_policy::always},
+  feature_spec{
+    cluster::cluster_version{12},
+    "cloud_storage_unindexed_segments",
+    feature::cloud_storage_unindexed_segments,
+    feature_spec::available_policy::always,
     feature_spec::prepare_policy::always}};
 
 std::string_view to_string_view(feature);
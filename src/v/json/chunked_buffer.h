@@ -0,0 +1,52 @@
+// Copyright 2023 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#pragma once
+
+#include "bytes/iobuf.h"
+#include "json/_include_first.h"
+#include "json/encodings.h"
+
+namespace json {
+
+/**
+ * \brief A rapidjson OutputStream that writes into an iobuf.
+ *
+ * Unlike StringBuffer the output is never contiguous, so serializing a large
+ * document does not need a large allocation, nor a copy to hand it off.
+ */
+template<typename Encoding = json::UTF8<>>
+class generic_chunked_buffer {
+public:
+    using Ch = typename Encoding::Ch;
+
+    generic_chunked_buffer() = default;
+    generic_chunked_buffer(const generic_chunked_buffer&) = delete;
+    generic_chunked_buffer& operator=(const generic_chunked_buffer&) = delete;
+    generic_chunked_buffer(generic_chunked_buffer&&) noexcept = default;
+    generic_chunked_buffer& operator=(generic_chunked_buffer&&) noexcept
+      = default;
+    ~generic_chunked_buffer() = default;
+
+    void Put(Ch c) { _impl.append(&c, sizeof(Ch)); }
+    void Flush() {}
+
+    /// \brief Appends \p buf as is, sharing its fragments where possible.
+    void append(iobuf buf) { _impl.append(std::move(buf)); }
+
+    size_t size_bytes() const { return _impl.size_bytes(); }
+    iobuf as_iobuf() && { return std::move(_impl); }
+
+private:
+    iobuf _impl;
+};
+
+using chunked_buffer = generic_chunked_buffer<>;
+
+} // namespace json
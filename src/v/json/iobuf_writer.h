@@ -0,0 +1,45 @@
+// Copyright 2023 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#pragma once
+
+#include "bytes/iobuf.h"
+#include "json/chunked_buffer.h"
+#include "json/writer.h"
+
+namespace json {
+
+/**
+ * \brief A Writer into a chunked_buffer.
+ *
+ * In addition to the Writer interface it can write a string value whose
+ * contents are already an iobuf, which is appended to the output without
+ * being linearized or copied a character at a time.
+ */
+template<typename Buffer = chunked_buffer>
+class iobuf_writer : public Writer<Buffer> {
+public:
+    explicit iobuf_writer(Buffer& buf)
+      : Writer<Buffer>(buf) {}
+
+    /// \brief Writes \p contents as a string value.
+    ///
+    /// The contents are not escaped, so they must not contain characters that
+    /// need escaping in a JSON string, e.g. base64.
+    bool RawString(iobuf contents) {
+        static constexpr typename Buffer::Ch quote{'"'};
+        // Opens the string while keeping track of the document structure
+        auto ret = this->RawValue(&quote, 1, rapidjson::kStringType);
+        this->os_->append(std::move(contents));
+        this->os_->Put(quote);
+        return ret;
+    }
+};
+
+} // namespace json
@@ -237,13 +237,7 @@ ss::future<produce_response> client::produce_records(
     for (auto& record : records) {
         auto p_id = record.partition_id;
         if (!p_id) {
-            p_id = co_await gated_retry_with_mitigation([&, this]() {
-                       return _topic_cache.partition_for(topic, record);
-                   }).handle_exception_type([](const topic_error&) {
-                // Assume auto topic creation is on and assign to first
-                // partition
-                return model::partition_id{0};
-            });
+            p_id = co_await partition_for(topic, record);
         }
         auto it = partition_builders.find(*p_id);
         if (it == partition_builders.end()) {
@@ -287,6 +281,16 @@ ss::future<produce_response> client::produce_records(
         .throttle_time_ms{{std::chrono::milliseconds{0}}}}};
 }
 
+ss::future<model::partition_id>
+client::partition_for(model::topic_view topic, const record_essence& record) {
+    co_return co_await gated_retry_with_mitigation([&, this]() {
+        return _topic_cache.partition_for(topic, record);
+    }).handle_exception_type([](const topic_error&) {
+        // Assume auto topic creation is on and assign to first partition
+        return model::partition_id{0};
+    });
+}
+
 ss::future<create_topics_response>
 client::create_topic(kafka::creatable_topic req) {
     return gated_retry_with_mitigation([this, req{std::move(req)}]() {
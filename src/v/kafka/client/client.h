@@ -118,6 +118,10 @@ public:
     ss::future<produce_response>
     produce_records(model::topic topic, std::vector<record_essence> batch);
 
+    /// \brief The partition produce_records assigns to a record without one.
+    ss::future<model::partition_id>
+    partition_for(model::topic_view topic, const record_essence& record);
+
     ss::future<list_offsets_response> list_offsets(model::topic_partition tp);
 
     ss::future<fetch_response> fetch_partition(
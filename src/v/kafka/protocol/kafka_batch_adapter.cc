@@ -17,6 +17,7 @@
 #include "likely.h"
 #include "model/fundamental.h"
 #include "model/record.h"
+#include "model/record_utils.h"
 #include "raft/types.h"
 #include "storage/parser_utils.h"
 #include "vassert.h"
@@ -29,7 +30,8 @@
 
 namespace kafka {
 
-model::record_batch_header kafka_batch_adapter::read_header(iobuf_parser& in) {
+model::record_batch_header
+kafka_batch_adapter::read_header(iobuf_parser_base& in) {
     const size_t initial_bytes_consumed = in.bytes_consumed();
 
     auto base_offset = model::offset(in.consume_be_type<int64_t>());
@@ -96,8 +98,10 @@ model::record_batch_header kafka_batch_adapter::read_header(iobuf_parser& in) {
     return header;
 }
 
-void kafka_batch_adapter::verify_crc(int32_t expected_crc, iobuf_parser in) {
+void kafka_batch_adapter::verify_crc(
+  int32_t expected_crc, const iobuf& kbatch) {
     auto crc = crc::crc32c();
+    iobuf_const_parser in(kbatch);
 
     // move the cursor to correct offset where the data to be checksummed
     // begins. That location skips the following 21 bytes:
@@ -145,20 +149,30 @@ iobuf kafka_batch_adapter::adapt(iobuf&& kbatch) {
         return iobuf{};
     }
 
-    auto batch_length =
-      [peeker{iobuf_parser(kbatch.share(0, kafka_length_diff))}]() mutable {
-          peeker.skip(sizeof(model::record_batch_header::base_offset));
-          return peeker.consume_be_type<int32_t>() + kafka_length_diff;
-      }();
-
-    auto remainder = kbatch.share(
-      batch_length, kbatch.size_bytes() - batch_length);
-    kbatch.trim_back(remainder.size_bytes());
-
-    auto crcparser = iobuf_parser(kbatch.share(0, kbatch.size_bytes()));
-    auto parser = iobuf_parser(std::move(kbatch));
+    /*
+     * The batch is parsed in place: headers and crc are read through const
+     * parsers and the records end up owning the fragments of the request
+     * itself. Nothing below shares or copies the record bytes.
+     */
+    auto batch_length = [&kbatch]() {
+        iobuf_const_parser peeker(kbatch);
+        peeker.skip(sizeof(model::record_batch_header::base_offset));
+        return peeker.consume_be_type<int32_t>() + kafka_length_diff;
+    }();
+
+    // produce requests carry a single batch per partition, so there is
+    // usually nothing left over to split off
+    iobuf remainder;
+    if (kbatch.size_bytes() > batch_length) {
+        remainder = kbatch.share(
+          batch_length, kbatch.size_bytes() - batch_length);
+        kbatch.trim_back(remainder.size_bytes());
+    }
 
-    auto header = read_header(parser);
+    auto header = [this, &kbatch]() {
+        iobuf_const_parser parser(kbatch);
+        return read_header(parser);
+    }();
     if (unlikely(!v2_format)) {
         vlog(
           klog.error,
@@ -166,7 +180,7 @@ iobuf kafka_batch_adapter::adapt(iobuf&& kbatch) {
         return remainder;
     }
 
-    verify_crc(header.crc, std::move(crcparser));
+    verify_crc(header.crc, kbatch);
     if (unlikely(!valid_crc)) {
         vlog(klog.warn, "batch has invalid CRC: {}", header);
         return remainder;
@@ -174,19 +188,34 @@ iobuf kafka_batch_adapter::adapt(iobuf&& kbatch) {
 
     auto records_size = header.size_bytes
                         - model::packed_record_batch_header_size;
-    auto records = parser.share(records_size);
+    kbatch.trim_front(internal::kafka_header_size);
+    // the crc only covers the bytes that were sent, the batch length is
+    // checked separately so that a short batch can't be built
+    if (unlikely(
+          records_size < 0
+          || kbatch.size_bytes() != static_cast<size_t>(records_size))) {
+        valid_crc = false;
+        vlog(
+          klog.warn,
+          "batch size doesn't match its records, expected: {}, got: {}, {}",
+          records_size,
+          kbatch.size_bytes(),
+          header);
+        return remainder;
+    }
 
     auto new_batch = model::record_batch(
-      header, std::move(records), model::record_batch::tag_ctor_ng{});
+      header, std::move(kbatch), model::record_batch::tag_ctor_ng{});
 
     /**
      * Perform some type of validation on the uncompressed input. In this case
-     * we make sure that the records can be materialized but we avoid
-     * re-encoding them using the lazy-record optimization.
+     * we make sure that the records are well formed, walking their framing
+     * without materializing (and copying) keys, values and headers.
      */
     if (!new_batch.compressed()) {
         try {
-            new_batch.for_each_record([](model::record r) { (void)r; });
+            model::verify_record_framing(
+              new_batch.data(), new_batch.record_count());
         } catch (const std::exception& e) {
             vlog(klog.error, "Parsing uncompressed records: {}", e.what());
             return remainder;
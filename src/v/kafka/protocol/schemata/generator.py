@@ -1130,6 +1130,7 @@ namespace kafka {
 namespace protocol {
 class decoder;
 class encoder;
+class sizer;
 }
 class response;
 
@@ -1146,6 +1147,12 @@ class response;
     void decode(protocol::decoder&, api_version);
 {%- else %}
     void decode(iobuf, api_version);
+{%- if struct.fields %}
+
+    /// Counts the bytes encode() produces at the given version without
+    /// writing them; used by encode() to reserve the output up front.
+    void measure(protocol::sizer&, api_version) const;
+{%- endif %}
 {%- endif %}
 
     friend std::ostream& operator<<(std::ostream&, const {{ struct.name }}&);
@@ -1239,8 +1246,9 @@ if ({{ cond }}) {
 {%- endif %}
 {% endmacro %}
 
-{% macro field_encoder(field, methods, obj, writer = "writer") %}
+{% macro field_encoder(field, methods, obj, writer = "writer", writer_type = "protocol::encoder") %}
 {%- set flex = methods|length > 1 %}
+{%- set cv = "const " if writer_type == "protocol::sizer" else "" %}
 {%- if obj %}
 {%- set fname = obj + "." + field.name %}
 {%- else %}
@@ -1249,15 +1257,15 @@ if ({{ cond }}) {
 {%- if field.is_array %}
 {%- if field.nullable() %}
 {%- if flex %}
-{{ writer }}.write_nullable_flex_array({{ fname }}, [version]({{ field.value_type }}& v, protocol::encoder& writer) {
+{{ writer }}.write_nullable_flex_array({{ fname }}, [version]({{ cv }}{{ field.value_type }}& v, {{ writer_type }}& writer) {
 {%- else %}
-{{ writer }}.write_nullable_array({{ fname }}, [version]({{ field.value_type }}& v, protocol::encoder& writer) {
+{{ writer }}.write_nullable_array({{ fname }}, [version]({{ cv }}{{ field.value_type }}& v, {{ writer_type }}& writer) {
 {%- endif %}
 {%- else %}
 {%- if flex %}
-{{ writer }}.write_flex_array({{ fname }}, [version]({{ field.value_type }}& v, protocol::encoder& writer) {
+{{ writer }}.write_flex_array({{ fname }}, [version]({{ cv }}{{ field.value_type }}& v, {{ writer_type }}& writer) {
 {%- else %}
-{{ writer }}.write_array({{ fname }}, [version]({{ field.value_type }}& v, protocol::encoder& writer) {
+{{ writer }}.write_array({{ fname }}, [version]({{ cv }}{{ field.value_type }}& v, {{ writer_type }}& writer) {
 {%- endif %}
 {%- endif %}
     (void)version;
@@ -1437,10 +1445,64 @@ writer.write_tags(std::move({{ tf }}));
 {%- endif %}
 {%- endmacro %}
 
+{% macro field_sizer(field, methods, obj, writer = "writer") %}
+{{- field_encoder(field, methods, obj, writer, "protocol::sizer") }}
+{%- endmacro %}
+
+{% macro tag_sizer_impl(tag_definitions, obj = "") %}
+/// Tags sizing section, mirrors tag_encoder_impl
+std::vector<uint32_t> to_encode;
+{%- for tdef in tag_definitions -%}
+{%- call tag_version_guard(tdef) %}
+{{- conditional_tag_encode(tdef, "to_encode", obj) }}
+{%- endcall %}
+{%- endfor %}
+{%- set tf = "unknown_tags" %}
+{%- if obj != "" %}
+{%- set tf = obj + '.unknown_tags' %}
+{%- endif %}
+size_t known_tags = 0;
+uint32_t known_tags_size = 0;
+for(uint32_t tag : to_encode) {
+    if ({{ tf }}().contains(tag_id(tag))) {
+        continue;
+    }
+    protocol::sizer rw;
+    switch(tag){
+{%- for tdef in tag_definitions %}
+    case {{ tdef.tag() }}:
+{{- field_sizer(tdef, (field_sizer, tag_sizer), obj, "rw") | indent | indent }}
+        break;
+{%- endfor %}
+    default:
+        __builtin_unreachable();
+    }
+    ++known_tags;
+    known_tags_size += protocol::sizer::tag_size(tag, rw.size_bytes());
+}
+writer.write_tags({{ tf }}, known_tags, known_tags_size);
+{%- endmacro %}
+
+{% macro tag_sizer(tag_definitions, obj = "") %}
+{%- if tag_definitions|length == 0 %}
+{%- set tf = "unknown_tags" %}
+{%- if obj != "" %}
+{%- set tf = obj + '.unknown_tags' %}
+{%- endif %}
+writer.write_tags({{ tf }});
+{%- else %}
+{
+{{- tag_sizer_impl(tag_definitions, obj) | indent }}
+}
+{%- endif %}
+{%- endmacro %}
+
 {% set encoder = (field_encoder,) %}
 {% set decoder = (field_decoder,) %}
 {% set flex_encoder = (field_encoder, tag_encoder) %}
 {% set flex_decoder = (field_decoder, tag_decoder) %}
+{% set sizer = (field_sizer,) %}
+{% set flex_sizer = (field_sizer, tag_sizer) %}
 
 {% macro struct_serde(struct, serde_methods, obj = "") %}
 {%- set flex = serde_methods|length > 1 %}
@@ -1500,11 +1562,20 @@ bool {{ struct.name }}::errored() const {
 {%- endif %}
 {% endmacro %}
 
+{% macro reserve_layout() %}
+{%- if op_type == "response" %}
+    protocol::sizer layout;
+    measure(layout, version);
+    writer.reserve(std::move(layout));
+{%- endif %}
+{%- endmacro %}
+
 namespace kafka {
 
 {%- if struct.fields %}
 {%- if first_flex > 0 %}
 void {{ struct.name }}::encode(protocol::encoder& writer, api_version version) {
+{{- reserve_layout() }}
     if (version >= api_version({{ first_flex }})) {
         encode_flex(writer, version);
     } else {
@@ -1522,14 +1593,33 @@ void {{ struct.name }}::encode_standard([[maybe_unused]] protocol::encoder& writ
 
 {%- elif first_flex < 0 %}
 void {{ struct.name }}::encode(protocol::encoder& writer, [[maybe_unused]] api_version version) {
+{{- reserve_layout() }}
 {{- struct_serde(struct, encoder) | indent }}
 }
 {%- else %}
 void {{ struct.name }}::encode(protocol::encoder& writer, [[maybe_unused]] api_version version) {
+{{- reserve_layout() }}
 {{- struct_serde(struct, flex_encoder) | indent }}
 }
 {%- endif %}
 
+{%- if op_type == "response" %}
+
+void {{ struct.name }}::measure(protocol::sizer& writer, [[maybe_unused]] api_version version) const {
+{%- if first_flex > 0 %}
+    if (version >= api_version({{ first_flex }})) {
+{{- struct_serde(struct, flex_sizer) | indent | indent }}
+    } else {
+{{- struct_serde(struct, sizer) | indent | indent }}
+    }
+{%- elif first_flex < 0 %}
+{{- struct_serde(struct, sizer) | indent }}
+{%- else %}
+{{- struct_serde(struct, flex_sizer) | indent }}
+{%- endif %}
+}
+{%- endif %}
+
 
 {%- if op_type == "request" %}
 {%- if first_flex > 0 %}
@@ -9,6 +9,7 @@
 
 #include "bytes/details/io_iterator_consumer.h"
 #include "bytes/iobuf_parser.h"
+#include "hashing/crc32c.h"
 #include "kafka/protocol/batch_consumer.h"
 #include "kafka/protocol/batch_reader.h"
 #include "kafka/protocol/exceptions.h"
@@ -17,6 +18,7 @@
 #include "model/tests/random_batch.h"
 #include "redpanda/tests/fixture.h"
 
+#include <seastar/core/byteorder.hh>
 #include <seastar/core/circular_buffer.hh>
 #include <seastar/core/sstring.hh>
 
@@ -223,3 +225,31 @@ SEASTAR_THREAD_TEST_CASE(batch_reader_record_batch_reader_impl_fail_magic) {
           return e.error == kafka::error_code::corrupt_message;
       });
 }
+
+SEASTAR_THREAD_TEST_CASE(kafka_batch_adapter_fail_truncated_records) {
+    auto ctx = make_context(base_offset, 1);
+    // drop the tail of the records but keep the batch length, and fix up the
+    // crc so that it covers the bytes which are left, as if the client sent
+    // less than it claimed
+    ctx.record_set.trim_back(10);
+    constexpr size_t crc_data_offset = crc_offset + sizeof(int32_t);
+    auto crc = crc::crc32c();
+    crc_extend_iobuf(
+      crc,
+      ctx.record_set.share(
+        crc_data_offset, ctx.record_set.size_bytes() - crc_data_offset));
+    auto crc_be = ss::cpu_to_be(crc.value());
+
+    iobuf record_set;
+    record_set.append(ctx.record_set.share(0, crc_offset));
+    record_set.append(
+      reinterpret_cast<const char*>(&crc_be), sizeof(crc_be)); // NOLINT
+    record_set.append(ctx.record_set.share(
+      crc_data_offset, ctx.record_set.size_bytes() - crc_data_offset));
+
+    kafka::kafka_batch_adapter kba;
+    kba.adapt(std::move(record_set));
+    BOOST_REQUIRE(kba.v2_format);
+    BOOST_REQUIRE(!kba.valid_crc);
+    BOOST_REQUIRE(!kba.batch);
+}
@@ -0,0 +1,139 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "kafka/protocol/fetch.h"
+#include "kafka/protocol/metadata.h"
+#include "kafka/protocol/wire.h"
+#include "random/generators.h"
+
+#include <seastar/testing/thread_test_case.hh>
+
+namespace {
+
+kafka::fetch_response_data
+make_fetch_response(size_t topics, size_t partitions) {
+    kafka::fetch_response_data data;
+    for (size_t t = 0; t < topics; ++t) {
+        kafka::fetchable_topic_response topic{
+          .name = model::topic(random_generators::gen_alphanum_string(20))};
+        for (size_t p = 0; p < partitions; ++p) {
+            kafka::fetchable_partition_response partition{
+              .partition_index = model::partition_id(p),
+              .high_watermark = model::offset(p * 100),
+            };
+            // mix empty, null and non-empty record sets so that runs of inline
+            // bytes are separated by payloads of every shape
+            if (p % 3 == 0) {
+                partition.records = kafka::batch_reader(
+                  random_generators::make_iobuf(64 + p));
+            } else if (p % 3 == 1) {
+                partition.records = kafka::batch_reader(iobuf{});
+            }
+            if (p % 5 == 0) {
+                partition.aborted = std::vector<kafka::aborted_transaction>{
+                  {.producer_id = kafka::producer_id(p),
+                   .first_offset = int64_t(p)}};
+            }
+            topic.partitions.push_back(std::move(partition));
+        }
+        data.topics.push_back(std::move(topic));
+    }
+    return data;
+}
+
+kafka::metadata_response_data make_metadata_response(size_t topics) {
+    kafka::metadata_response_data data;
+    data.brokers.push_back(kafka::metadata_response_broker{
+      .node_id = model::node_id(0), .host = "localhost", .port = 9092});
+    for (size_t t = 0; t < topics; ++t) {
+        kafka::metadata_response_topic topic{
+          .name = model::topic(random_generators::gen_alphanum_string(30))};
+        for (int p = 0; p < 16; ++p) {
+            topic.partitions.push_back(kafka::metadata_response_partition{
+              .partition_index = model::partition_id(p),
+              .leader_id = model::node_id(0),
+              .replica_nodes = {model::node_id(0)},
+              .isr_nodes = {model::node_id(0)}});
+        }
+        data.topics.push_back(std::move(topic));
+    }
+    return data;
+}
+
+template<typename T>
+iobuf encode_measured(T data, kafka::api_version version) {
+    kafka::protocol::sizer layout;
+    data.measure(layout, version);
+    auto expected = layout.size_bytes();
+
+    iobuf out;
+    kafka::protocol::encoder writer(out);
+    data.encode(writer, version);
+    BOOST_REQUIRE_EQUAL(out.size_bytes(), expected);
+
+    // every inline run is written into exactly one fragment reserved for it
+    // and payloads are shared, so no fragment is left with spare capacity
+    for (const auto& f : out) {
+        BOOST_REQUIRE_EQUAL(f.available_bytes(), 0);
+    }
+    return out;
+}
+
+} // namespace
+
+SEASTAR_THREAD_TEST_CASE(fetch_response_encodes_into_measured_layout) {
+    for (auto v : {0, 4, 7, 11}) {
+        auto version = kafka::api_version(v);
+        auto out = encode_measured(make_fetch_response(3, 50), version);
+
+        kafka::fetch_response_data decoded;
+        decoded.decode(std::move(out), version);
+        BOOST_REQUIRE_EQUAL(decoded.topics.size(), 3);
+        for (size_t t = 0; t < decoded.topics.size(); ++t) {
+            const auto& partitions = decoded.topics[t].partitions;
+            BOOST_REQUIRE_EQUAL(partitions.size(), 50);
+            for (size_t p = 0; p < partitions.size(); ++p) {
+                BOOST_REQUIRE_EQUAL(
+                  partitions[p].partition_index, model::partition_id(p));
+                BOOST_REQUIRE_EQUAL(
+                  partitions[p].records.has_value(), p % 3 != 2);
+                if (partitions[p].records) {
+                    BOOST_REQUIRE_EQUAL(
+                      partitions[p].records->size_bytes(),
+                      p % 3 == 0 ? 64 + p : 0);
+                }
+            }
+        }
+    }
+}
+
+SEASTAR_THREAD_TEST_CASE(metadata_response_encodes_into_measured_layout) {
+    for (auto v : {0, 5, 9, 11}) {
+        auto version = kafka::api_version(v);
+        auto data = make_metadata_response(100);
+        std::vector<model::topic> names;
+        for (const auto& t : data.topics) {
+            names.push_back(t.name);
+        }
+        auto out = encode_measured(std::move(data), version);
+
+        // without payloads the whole response lands in a single fragment
+        BOOST_REQUIRE_EQUAL(std::distance(out.begin(), out.end()), 1);
+
+        kafka::metadata_response_data decoded;
+        decoded.decode(std::move(out), version);
+        BOOST_REQUIRE_EQUAL(decoded.topics.size(), names.size());
+        for (size_t t = 0; t < decoded.topics.size(); ++t) {
+            BOOST_REQUIRE_EQUAL(decoded.topics[t].name, names[t]);
+            BOOST_REQUIRE_EQUAL(decoded.topics[t].partitions.size(), 16);
+        }
+    }
+}
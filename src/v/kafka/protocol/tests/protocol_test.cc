@@ -88,6 +88,12 @@ concept HasPrimitiveDecode = requires(T t, iobuf iob, api_version v) {
     { t.decode(std::move(iob), v) } -> std::same_as<void>;
 };
 
+/// Generated response types can measure their encoded size up front
+template<typename T>
+concept HasMeasure = requires(const T t, protocol::sizer& s, api_version v) {
+    { t.measure(s, v) } -> std::same_as<void>;
+};
+
 /// If there is an issue with decoding of legacy batches, an exception will not
 /// be thrown. To make the test aware of these potential issues, each
 /// kafka_batch_adapter for every partition in a request must be queried for its
@@ -145,10 +151,27 @@ void check_kafka_binary_format(
                 version));
             return;
         }
+        std::optional<size_t> measured;
+        if constexpr (HasMeasure<decltype(r)>) {
+            kafka::protocol::sizer layout;
+            r.measure(layout, version);
+            measured = layout.size_bytes();
+        }
         iobuf iob;
         kafka::protocol::encoder rw(iob);
         r.encode(rw, version);
         b = iobuf_to_bytes(iob);
+        if (measured) {
+            BOOST_TEST(
+              *measured == b.size(),
+              fmt::format(
+                "Measured size mismatch for api: {} at version: {} "
+                "measured: {} encoded: {}",
+                key,
+                version,
+                *measured,
+                b.size()));
+        }
     }
     BOOST_TEST(
       b == result,
@@ -0,0 +1,109 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "kafka/protocol/fetch.h"
+#include "kafka/protocol/metadata.h"
+#include "kafka/protocol/wire.h"
+#include "random/generators.h"
+
+#include <seastar/testing/perf_tests.hh>
+
+namespace {
+
+kafka::fetch_response_data
+make_fetch_response(size_t partitions, size_t record_set_size) {
+    kafka::fetch_response_data data;
+    kafka::fetchable_topic_response topic{
+      .name = model::topic(random_generators::gen_alphanum_string(30))};
+    for (size_t p = 0; p < partitions; ++p) {
+        topic.partitions.push_back(kafka::fetchable_partition_response{
+          .partition_index = model::partition_id(p),
+          .high_watermark = model::offset(p),
+          .last_stable_offset = model::offset(p),
+          .log_start_offset = model::offset(0),
+          .records = kafka::batch_reader(
+            random_generators::make_iobuf(record_set_size))});
+    }
+    data.topics.push_back(std::move(topic));
+    return data;
+}
+
+kafka::metadata_response_data
+make_metadata_response(size_t topics, int partitions) {
+    kafka::metadata_response_data data;
+    for (int n = 0; n < 3; ++n) {
+        data.brokers.push_back(kafka::metadata_response_broker{
+          .node_id = model::node_id(n),
+          .host = random_generators::gen_alphanum_string(20),
+          .port = 9092});
+    }
+    for (size_t t = 0; t < topics; ++t) {
+        kafka::metadata_response_topic topic{
+          .name = model::topic(random_generators::gen_alphanum_string(30))};
+        for (int p = 0; p < partitions; ++p) {
+            std::vector<model::node_id> replicas{
+              model::node_id(0), model::node_id(1), model::node_id(2)};
+            topic.partitions.push_back(kafka::metadata_response_partition{
+              .partition_index = model::partition_id(p),
+              .leader_id = model::node_id(p % 3),
+              .leader_epoch = kafka::leader_epoch(1),
+              .replica_nodes = replicas,
+              .isr_nodes = replicas});
+        }
+        data.topics.push_back(std::move(topic));
+    }
+    return data;
+}
+
+template<typename T>
+void encode(T data, kafka::api_version version) {
+    iobuf out;
+    kafka::protocol::encoder writer(out);
+    perf_tests::start_measuring_time();
+    data.encode(writer, version);
+    perf_tests::do_not_optimize(out);
+    perf_tests::stop_measuring_time();
+}
+
+template<typename T>
+void measure(const T& data, kafka::api_version version) {
+    kafka::protocol::sizer layout;
+    perf_tests::start_measuring_time();
+    data.measure(layout, version);
+    perf_tests::do_not_optimize(layout);
+    perf_tests::stop_measuring_time();
+}
+
+} // namespace
+
+PERF_TEST(fetch_response, encode_1k_partitions) {
+    encode(make_fetch_response(1000, 256), kafka::api_version(11));
+}
+
+PERF_TEST(fetch_response, encode_10k_partitions) {
+    encode(make_fetch_response(10000, 64), kafka::api_version(11));
+}
+
+PERF_TEST(fetch_response, measure_10k_partitions) {
+    measure(make_fetch_response(10000, 64), kafka::api_version(11));
+}
+
+PERF_TEST(metadata_response, encode_1k_topics) {
+    encode(make_metadata_response(1000, 16), kafka::api_version(9));
+}
+
+PERF_TEST(metadata_response, encode_1k_topics_legacy) {
+    encode(make_metadata_response(1000, 16), kafka::api_version(7));
+}
+
+PERF_TEST(metadata_response, measure_1k_topics) {
+    measure(make_metadata_response(1000, 16), kafka::api_version(9));
+}
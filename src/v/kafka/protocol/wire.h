@@ -12,6 +12,7 @@
 #pragma once
 
 #include "bytes/bytes.h"
+#include "bytes/details/io_allocation_size.h"
 #include "bytes/iobuf_parser.h"
 #include "kafka/protocol/batch_reader.h"
 #include "kafka/protocol/types.h"
@@ -25,8 +26,10 @@
 
 #include <fmt/format.h>
 
+#include <algorithm>
 #include <optional>
 #include <type_traits>
+#include <vector>
 
 namespace seastar {
 template<typename T>
@@ -308,6 +311,213 @@ concept SizedContainer = requires(C c, const C cc) {
     { cc.end() } -> std::same_as<typename C::const_iterator>;
 };
 
+/**
+ * First pass of the two pass response encoding.
+ *
+ * The sizer mirrors the write interface of the encoder below but only counts
+ * the bytes each call would produce. Generated response types run it over
+ * their fields (see `measure` in generator.py) to obtain the exact encoded
+ * size together with the layout of the output: the runs of bytes that the
+ * encoder copies inline, separated by the payloads (record sets, nullable
+ * bytes) that it appends by sharing fragments. The encoder then reserves one
+ * exactly sized fragment per run so that every field write is a plain store
+ * into memory that is already there.
+ */
+class sizer {
+    uint32_t add(uint32_t n) {
+        _size += n;
+        _run += n;
+        return n;
+    }
+
+    uint32_t add_payload(uint32_t n) {
+        _size += n;
+        _runs.push_back(_run);
+        _run = 0;
+        return n;
+    }
+
+public:
+    template<typename T>
+    requires std::is_arithmetic_v<T> || std::is_enum_v<T>
+    uint32_t write(T) {
+        return add(sizeof(T));
+    }
+
+    uint32_t write(model::timestamp) { return add(sizeof(int64_t)); }
+
+    uint32_t write_unsigned_varint(uint32_t v) {
+        return add(unsigned_vint::size(v));
+    }
+
+    uint32_t write_varint(int32_t v) { return add(vint::vint_size(v)); }
+
+    uint32_t write_varlong(int64_t v) { return add(vint::vint_size(v)); }
+
+    uint32_t write(std::string_view v) {
+        return add(sizeof(int16_t) + v.size());
+    }
+
+    uint32_t write_flex(std::string_view v) {
+        return add(unsigned_vint::size(v.size() + 1) + v.size());
+    }
+
+    uint32_t write(const ss::sstring& v) { return write(std::string_view(v)); }
+
+    uint32_t write_flex(const ss::sstring& v) {
+        return write_flex(std::string_view(v));
+    }
+
+    uint32_t write(const std::optional<ss::sstring>& v) {
+        if (!v) {
+            return add(sizeof(int16_t));
+        }
+        return write(std::string_view(*v));
+    }
+
+    uint32_t write_flex(const std::optional<ss::sstring>& v) {
+        if (!v) {
+            return write_unsigned_varint(0);
+        }
+        return write_flex(std::string_view(*v));
+    }
+
+    uint32_t write(uuid) { return add(uuid::length); }
+
+    uint32_t write(bytes_view bv) { return add(sizeof(int32_t) + bv.size()); }
+
+    uint32_t write_flex(bytes_view bv) {
+        return add(unsigned_vint::size(bv.size() + 1) + bv.size());
+    }
+
+    uint32_t write(const model::topic& topic) { return write(topic()); }
+
+    uint32_t write(const std::optional<iobuf>& data) {
+        if (!data) {
+            return add(sizeof(int32_t));
+        }
+        return add(sizeof(int32_t)) + add_payload(data->size_bytes());
+    }
+
+    uint32_t write_flex(const std::optional<iobuf>& data) {
+        if (!data) {
+            return write_unsigned_varint(0);
+        }
+        return write_unsigned_varint(data->size_bytes() + 1)
+               + add_payload(data->size_bytes());
+    }
+
+    uint32_t write(const std::optional<batch_reader>& rdr) {
+        if (!rdr) {
+            return add(sizeof(int32_t));
+        }
+        return add(sizeof(int32_t)) + add_payload(rdr->size_bytes());
+    }
+
+    uint32_t write_flex(const std::optional<batch_reader>& rdr) {
+        if (!rdr) {
+            return write_unsigned_varint(0);
+        }
+        return write_unsigned_varint(rdr->size_bytes() + 1)
+               + add_payload(rdr->size_bytes());
+    }
+
+    template<typename T, typename Tag>
+    uint32_t write(const named_type<T, Tag>& t) {
+        return write(t());
+    }
+
+    template<typename T, typename Tag>
+    uint32_t write_flex(const named_type<T, Tag>& t) {
+        return write_flex(t());
+    }
+
+    template<typename Rep, typename Period>
+    uint32_t write(const std::chrono::duration<Rep, Period>&) {
+        return add(sizeof(int32_t));
+    }
+
+    template<typename C, typename ElementWriter>
+    uint32_t write_array(const C& v, ElementWriter&& writer) {
+        auto start_size = _size;
+        write(int32_t(v.size()));
+        for (const auto& elem : v) {
+            writer(elem, *this);
+        }
+        return _size - start_size;
+    }
+
+    template<typename T, typename ElementWriter>
+    uint32_t write_nullable_array(
+      const std::optional<std::vector<T>>& v, ElementWriter&& writer) {
+        if (!v) {
+            return write(int32_t(-1));
+        }
+        return write_array(*v, std::forward<ElementWriter>(writer));
+    }
+
+    template<typename C, typename ElementWriter>
+    uint32_t write_flex_array(const C& v, ElementWriter&& writer) {
+        auto start_size = _size;
+        write_unsigned_varint(v.size() + 1);
+        for (const auto& elem : v) {
+            writer(elem, *this);
+        }
+        return _size - start_size;
+    }
+
+    template<typename T, typename ElementWriter>
+    uint32_t write_nullable_flex_array(
+      const std::optional<std::vector<T>>& v, ElementWriter&& writer) {
+        if (!v) {
+            return write_unsigned_varint(0);
+        }
+        return write_flex_array(*v, std::forward<ElementWriter>(writer));
+    }
+
+    /// Size of a tag section holding only the given tags
+    uint32_t write_tags(const tagged_fields& tags) {
+        return write_tags(tags, 0, 0);
+    }
+
+    /// Size of a tag section holding the given tags plus `extra_tags` known
+    /// tags whose encoded size (including their headers) is `extra_bytes`
+    uint32_t write_tags(
+      const tagged_fields& tags, size_t extra_tags, uint32_t extra_bytes) {
+        auto start_size = _size;
+        write_unsigned_varint(tags().size() + extra_tags);
+        for (const auto& [id, tag] : tags()) {
+            add(tag_size(id, tag.size()));
+        }
+        add(extra_bytes);
+        return _size - start_size;
+    }
+
+    uint32_t write_tags() { return write_unsigned_varint(0); }
+
+    /// Encoded size of a tag with a body of `body_size` bytes
+    static uint32_t tag_size(uint32_t id, uint32_t body_size) {
+        return unsigned_vint::size(id) + unsigned_vint::size(body_size)
+               + body_size;
+    }
+
+    /// Total number of bytes the measured message encodes to
+    size_t size_bytes() const { return _size; }
+
+    /// Inline byte runs in encoding order. There is always one more run than
+    /// there are payloads; runs may be empty.
+    std::vector<uint32_t> release_runs() && {
+        _runs.push_back(_run);
+        _run = 0;
+        return std::move(_runs);
+    }
+
+private:
+    size_t _size{0};
+    uint32_t _run{0};
+    std::vector<uint32_t> _runs;
+};
+
 class encoder;
 void writer_serialize_batch(encoder& w, model::record_batch&& batch);
 
@@ -335,10 +545,43 @@ class encoder {
         return x.size();
     }
 
+    /// Appends a length prefixed payload. With a layout reserved the payload
+    /// fragments are shared rather than packed into the reserved run, and the
+    /// next run is reserved right behind it.
+    void append_payload(iobuf&& buf) {
+        if (_runs.empty()) {
+            _out->append(std::move(buf));
+            return;
+        }
+        _out->append_fragments(std::move(buf));
+        reserve_next_run();
+    }
+
+    void reserve_next_run() {
+        if (_next_run == _runs.size()) {
+            return;
+        }
+        // runs larger than the largest chunk continue in regular sized chunks
+        auto n = std::min<size_t>(
+          _runs[_next_run++], ::details::io_allocation_size::max_chunk_size);
+        if (n > 0) {
+            _out->append(std::make_unique<iobuf::fragment>(n));
+        }
+    }
+
 public:
     explicit encoder(iobuf& out) noexcept
       : _out(&out) {}
 
+    /// Reserves output memory for a message measured by a sizer. Must be
+    /// called before the message is written. A layout that does not match
+    /// what is written afterwards costs extra allocations, not correctness.
+    void reserve(sizer layout) {
+        _runs = std::move(layout).release_runs();
+        _next_run = 0;
+        reserve_next_run();
+    }
+
     uint32_t write(bool v) { return serialize_int<int8_t>(v); }
 
     uint32_t write(int8_t v) { return serialize_int<int8_t>(v); }
@@ -439,7 +682,7 @@ public:
         }
         auto size = serialize_int<int32_t>(data->size_bytes())
                     + data->size_bytes();
-        _out->append(std::move(*data));
+        append_payload(std::move(*data));
         return size;
     }
 
@@ -449,7 +692,7 @@ public:
         }
         auto size = write_unsigned_varint(data->size_bytes() + 1)
                     + data->size_bytes();
-        _out->append(std::move(*data));
+        append_payload(std::move(*data));
         return size;
     }
 
@@ -639,6 +882,8 @@ public:
 
 private:
     iobuf* _out;
+    std::vector<uint32_t> _runs;
+    size_t _next_run{0};
 };
 
 inline void writer_serialize_batch(encoder& w, model::record_batch&& batch) {
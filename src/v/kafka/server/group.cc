@@ -51,6 +51,7 @@ group::group(
   config::configuration& conf,
   ss::lw_shared_ptr<ssx::rwlock> catchup_lock,
   ss::lw_shared_ptr<cluster::partition> partition,
+  ss::lw_shared_ptr<offset_commit_batcher> commit_batcher,
   model::term_id term,
   ss::sharded<cluster::tx_gateway_frontend>& tx_frontend,
   ss::sharded<features::feature_table>& feature_table,
@@ -65,6 +66,7 @@ group::group(
   , _conf(conf)
   , _catchup_lock(std::move(catchup_lock))
   , _partition(std::move(partition))
+  , _offset_commit_batcher(std::move(commit_batcher))
   , _probe(_members, _static_members, _offsets)
   , _ctxlog(klog, *this)
   , _ctx_txlog(cluster::txlog, *this)
@@ -88,6 +90,7 @@ group::group(
   config::configuration& conf,
   ss::lw_shared_ptr<ssx::rwlock> catchup_lock,
   ss::lw_shared_ptr<cluster::partition> partition,
+  ss::lw_shared_ptr<offset_commit_batcher> commit_batcher,
   model::term_id term,
   ss::sharded<cluster::tx_gateway_frontend>& tx_frontend,
   ss::sharded<features::feature_table>& feature_table,
@@ -108,6 +111,7 @@ group::group(
   , _conf(conf)
   , _catchup_lock(std::move(catchup_lock))
   , _partition(std::move(partition))
+  , _offset_commit_batcher(std::move(commit_batcher))
   , _probe(_members, _static_members, _offsets)
   , _ctxlog(klog, *this)
   , _ctx_txlog(cluster::txlog, *this)
@@ -1894,7 +1898,7 @@ group::begin_tx(cluster::begin_group_tx_request r) {
 
     auto reader = model::make_memory_record_batch_reader(
       std::move(batch.value()));
-    auto res = co_await _partition->raft()->replicate(
+    auto res = co_await _offset_commit_batcher->replicate_after_commits(
       _term,
       std::move(reader),
       raft::replicate_options(raft::consistency_level::quorum_ack));
@@ -2117,7 +2121,7 @@ group::store_txn_offsets(txn_offset_commit_request r) {
       std::move(tx_entry));
     auto reader = model::make_memory_record_batch_reader(std::move(batch));
 
-    auto e = co_await _partition->raft()->replicate(
+    auto e = co_await _offset_commit_batcher->replicate_after_commits(
       _term,
       std::move(reader),
       raft::replicate_options(raft::consistency_level::quorum_ack));
@@ -2195,8 +2199,7 @@ kafka::error_code map_store_offset_error_code(std::error_code ec) {
     return error_code::unknown_server_error;
 }
 
-void group::update_store_offset_builder(
-  cluster::simple_batch_builder& builder,
+group_metadata_serializer::key_value group::make_offset_kv(
   const model::topic& name,
   model::partition_id partition,
   model::offset committed_offset,
@@ -2218,14 +2221,32 @@ void group::update_store_offset_builder(
         value.expiry_timestamp = expiry_timestamp.value();
     }
 
-    auto kv = _md_serializer.to_kv(
+    return _md_serializer.to_kv(
       offset_metadata_kv{.key = std::move(key), .value = std::move(value)});
+}
+
+void group::update_store_offset_builder(
+  cluster::simple_batch_builder& builder,
+  const model::topic& name,
+  model::partition_id partition,
+  model::offset committed_offset,
+  leader_epoch committed_leader_epoch,
+  const ss::sstring& metadata,
+  model::timestamp commit_timestamp,
+  std::optional<model::timestamp> expiry_timestamp) {
+    auto kv = make_offset_kv(
+      name,
+      partition,
+      committed_offset,
+      committed_leader_epoch,
+      metadata,
+      commit_timestamp,
+      expiry_timestamp);
     builder.add_raw_kv(std::move(kv.key), std::move(kv.value));
 }
 
 group::offset_commit_stages group::store_offsets(offset_commit_request&& r) {
-    cluster::simple_batch_builder builder(
-      model::record_batch_type::raft_data, model::offset(0));
+    std::vector<group_metadata_serializer::key_value> records;
 
     std::vector<std::pair<model::topic_partition, offset_metadata>>
       offset_commits;
@@ -2249,15 +2270,14 @@ group::offset_commit_stages group::store_offsets(offset_commit_request&& r) {
     for (const auto& t : r.data.topics) {
         for (const auto& p : t.partitions) {
             const auto commit_timestamp = get_commit_timestamp(p);
-            update_store_offset_builder(
-              builder,
+            records.push_back(make_offset_kv(
               t.name,
               p.partition_index,
               p.committed_offset,
               p.committed_leader_epoch,
               p.committed_metadata.value_or(""),
               commit_timestamp,
-              expiry_timestamp);
+              expiry_timestamp));
 
             model::topic_partition tp(t.name, p.partition_index);
 
@@ -2285,13 +2305,9 @@ group::offset_commit_stages group::store_offsets(offset_commit_request&& r) {
         }
     }
 
-    auto batch = std::move(builder).build();
-    auto reader = model::make_memory_record_batch_reader(std::move(batch));
-
-    auto replicate_stages = _partition->raft()->replicate_in_stages(
-      _term,
-      std::move(reader),
-      raft::replicate_options(raft::consistency_level::quorum_ack));
+    // Commits of all the groups of the partition are coalesced by the batcher
+    auto replicate_stages = _offset_commit_batcher->replicate(
+      _term, std::move(records));
 
     auto f = replicate_stages.replicate_finished.then(
       [this, req = std::move(r), commits = std::move(offset_commits)](
@@ -2647,10 +2663,11 @@ ss::future<error_code> group::remove() {
     auto reader = model::make_memory_record_batch_reader(std::move(batch));
 
     try {
-        auto result = co_await _partition->raft()->replicate(
-          _term,
-          std::move(reader),
-          raft::replicate_options(raft::consistency_level::quorum_ack));
+        auto result
+          = co_await _offset_commit_batcher->replicate_after_commits(
+            _term,
+            std::move(reader),
+            raft::replicate_options(raft::consistency_level::quorum_ack));
         if (result) {
             vlog(
               klog.trace,
@@ -2734,10 +2751,11 @@ group::remove_topic_partitions(const std::vector<model::topic_partition>& tps) {
     auto reader = model::make_memory_record_batch_reader(std::move(batch));
 
     try {
-        auto result = co_await _partition->raft()->replicate(
-          _term,
-          std::move(reader),
-          raft::replicate_options(raft::consistency_level::quorum_ack));
+        auto result
+          = co_await _offset_commit_batcher->replicate_after_commits(
+            _term,
+            std::move(reader),
+            raft::replicate_options(raft::consistency_level::quorum_ack));
         if (result) {
             vlog(
               klog.trace,
@@ -2769,7 +2787,7 @@ group::remove_topic_partitions(const std::vector<model::topic_partition>& tps) {
 
 ss::future<result<raft::replicate_result>>
 group::store_group(model::record_batch batch) {
-    return _partition->raft()->replicate(
+    return _offset_commit_batcher->replicate_after_commits(
       _term,
       model::make_memory_record_batch_reader(std::move(batch)),
       raft::replicate_options(raft::consistency_level::quorum_ack));
@@ -2913,7 +2931,7 @@ ss::future<cluster::abort_group_tx_reply> group::do_abort(
       std::move(tx));
     auto reader = model::make_memory_record_batch_reader(std::move(batch));
 
-    auto e = co_await _partition->raft()->replicate(
+    auto e = co_await _offset_commit_batcher->replicate_after_commits(
       _term,
       std::move(reader),
       raft::replicate_options(raft::consistency_level::quorum_ack));
@@ -2990,7 +3008,7 @@ group::do_commit(kafka::group_id group_id, model::producer_identity pid) {
 
     auto reader = model::make_memory_record_batch_reader(std::move(batches));
 
-    auto e = co_await _partition->raft()->replicate(
+    auto e = co_await _offset_commit_batcher->replicate_after_commits(
       _term,
       std::move(reader),
       raft::replicate_options(raft::consistency_level::quorum_ack));
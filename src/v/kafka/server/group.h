@@ -22,6 +22,7 @@
 #include "kafka/server/group_metadata.h"
 #include "kafka/server/logger.h"
 #include "kafka/server/member.h"
+#include "kafka/server/offset_commit_batcher.h"
 #include "kafka/types.h"
 #include "model/fundamental.h"
 #include "model/namespace.h"
@@ -204,6 +205,7 @@ public:
       config::configuration& conf,
       ss::lw_shared_ptr<ssx::rwlock> catchup_lock,
       ss::lw_shared_ptr<cluster::partition> partition,
+      ss::lw_shared_ptr<offset_commit_batcher> commit_batcher,
       model::term_id,
       ss::sharded<cluster::tx_gateway_frontend>& tx_frontend,
       ss::sharded<features::feature_table>&,
@@ -217,6 +219,7 @@ public:
       config::configuration& conf,
       ss::lw_shared_ptr<ssx::rwlock> catchup_lock,
       ss::lw_shared_ptr<cluster::partition> partition,
+      ss::lw_shared_ptr<offset_commit_batcher> commit_batcher,
       model::term_id,
       ss::sharded<cluster::tx_gateway_frontend>& tx_frontend,
       ss::sharded<features::feature_table>&,
@@ -648,6 +651,10 @@ public:
         return _partition;
     }
 
+    // writes to the group partition go through the batcher, see
+    // offset_commit_batcher::replicate_after_commits
+    offset_commit_batcher& commit_batcher() { return *_offset_commit_batcher; }
+
     ss::future<result<raft::replicate_result>> store_group(model::record_batch);
 
     // validates state of a member existing in a group
@@ -845,6 +852,15 @@ private:
         return false;
     }
 
+    group_metadata_serializer::key_value make_offset_kv(
+      const model::topic& name,
+      model::partition_id partition,
+      model::offset commited_offset,
+      leader_epoch commited_leader_epoch,
+      const ss::sstring& metadata,
+      model::timestamp commited_timestemp,
+      std::optional<model::timestamp> expiry_timestamp);
+
     void update_store_offset_builder(
       cluster::simple_batch_builder& builder,
       const model::topic& name,
@@ -909,6 +925,7 @@ private:
     config::configuration& _conf;
     ss::lw_shared_ptr<ssx::rwlock> _catchup_lock;
     ss::lw_shared_ptr<cluster::partition> _partition;
+    ss::lw_shared_ptr<offset_commit_batcher> _offset_commit_batcher;
     absl::node_hash_map<
       model::topic_partition,
       std::unique_ptr<offset_metadata_with_probe>>
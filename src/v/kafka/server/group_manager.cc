@@ -23,6 +23,7 @@
 #include "kafka/protocol/wire.h"
 #include "kafka/server/group_metadata.h"
 #include "kafka/server/group_recovery_consumer.h"
+#include "kafka/server/group_snapshot.h"
 #include "kafka/server/logger.h"
 #include "model/fundamental.h"
 #include "model/namespace.h"
@@ -59,7 +60,8 @@ group_manager::group_manager(
   , _conf(config::shard_local_cfg())
   , _self(cluster::make_self_broker(config::node()))
   , _enable_group_metrics(enable_metrics)
-  , _offset_retention_check(_conf.group_offset_retention_check_ms.bind()) {}
+  , _offset_retention_check(_conf.group_offset_retention_check_ms.bind())
+  , _snapshot_interval(_conf.group_state_snapshot_interval_ms.bind()) {}
 
 ss::future<> group_manager::start() {
     /*
@@ -130,8 +132,31 @@ ss::future<> group_manager::start() {
         }
     });
 
+    /*
+     * periodically snapshot the group state of attached partitions to speed
+     * up their recovery.
+     */
+    _snapshot_timer.set_callback([this] {
+        ssx::spawn_with_gate(_gate, [this] {
+            return take_snapshots().finally([this] { arm_snapshot_timer(); });
+        });
+    });
+    arm_snapshot_timer();
+    _snapshot_interval.watch([this] {
+        _snapshot_timer.cancel();
+        arm_snapshot_timer();
+    });
+
     return ss::make_ready_future<>();
 }
+
+void group_manager::arm_snapshot_timer() {
+    if (
+      !_gate.is_closed() && !_snapshot_timer.armed()
+      && _snapshot_interval() > 0ms) {
+        _snapshot_timer.arm(_snapshot_interval());
+    }
+}
 /*
  * Compute if retention is enabled.
  *
@@ -314,7 +339,7 @@ ss::future<size_t> group_manager::delete_offsets(
     auto reader = model::make_memory_record_batch_reader(std::move(batch));
 
     try {
-        auto result = co_await group->partition()->raft()->replicate(
+        auto result = co_await group->commit_batcher().replicate_after_commits(
           group->term(),
           std::move(reader),
           raft::replicate_options(raft::consistency_level::leader_ack));
@@ -383,6 +408,7 @@ ss::future<> group_manager::stop() {
     }
 
     _timer.cancel();
+    _snapshot_timer.cancel();
 
     return _gate.close().then([this]() {
         /**
@@ -434,7 +460,8 @@ ss::future<> group_manager::do_detach_partition(model::ntp ntp) {
 
 void group_manager::attach_partition(ss::lw_shared_ptr<cluster::partition> p) {
     klog.debug("attaching group metadata partition {}", p->ntp());
-    auto attached = ss::make_lw_shared<attached_partition>(p);
+    auto attached = ss::make_lw_shared<attached_partition>(
+      p, _conf.group_offset_commit_linger_ms.bind());
     auto res = _partitions.try_emplace(p->ntp(), attached);
     // TODO: this is not a forever assertion. this should just generally never
     // happen _now_ because we don't support partition migration / removal.
@@ -651,44 +678,177 @@ ss::future<> group_manager::handle_partition_leader_change(
                 }
 
                 /*
-                 * the full log is read and deduplicated. the dedupe
-                 * processing is based on the record keys, so this code
-                 * should be ready to transparently take advantage of
-                 * key-based compaction in the future.
+                 * the full log, or the part of it that follows the local
+                 * snapshot, is read and deduplicated. the dedupe processing
+                 * is based on the record keys, so this code should be ready
+                 * to transparently take advantage of key-based compaction in
+                 * the future.
                  */
-                storage::log_reader_config reader_config(
-                  p->partition->raft_start_offset(),
-                  model::model_limits<model::offset>::max(),
-                  0,
-                  std::numeric_limits<size_t>::max(),
-                  kafka_read_priority(),
-                  std::nullopt,
-                  std::nullopt,
-                  std::nullopt);
-
-                return p->partition->make_reader(reader_config)
-                  .then([this, term, p, timeout](
-                          model::record_batch_reader reader) {
-                      return std::move(reader)
-                        .consume(
-                          group_recovery_consumer(_serializer_factory(), p->as),
-                          timeout)
-                        .then([this, term, p](
-                                group_recovery_consumer_state state) {
-                            // avoid trying to recover if we stopped the
-                            // reader because an abort was requested
-                            if (p->as.abort_requested()) {
-                                return ss::make_ready_future<>();
-                            }
-                            return recover_partition(term, p, std::move(state))
-                              .then([p] { p->loading = false; });
-                        });
-                  });
+                return load_snapshot(p).then([this, term, p, timeout](
+                                               recovery_start start) mutable {
+                    storage::log_reader_config reader_config(
+                      start.next_offset,
+                      model::model_limits<model::offset>::max(),
+                      0,
+                      std::numeric_limits<size_t>::max(),
+                      kafka_read_priority(),
+                      std::nullopt,
+                      std::nullopt,
+                      std::nullopt);
+
+                    return p->partition->make_reader(reader_config)
+                      .then([this,
+                             term,
+                             p,
+                             timeout,
+                             state = std::move(start.state)](
+                              model::record_batch_reader reader) mutable {
+                          return std::move(reader)
+                            .consume(
+                              group_recovery_consumer(
+                                _serializer_factory(), p->as, std::move(state)),
+                              timeout)
+                            .then([this, term, p](
+                                    group_recovery_consumer_state state) {
+                                // avoid trying to recover if we stopped the
+                                // reader because an abort was requested
+                                if (p->as.abort_requested()) {
+                                    return ss::make_ready_future<>();
+                                }
+                                return recover_partition(
+                                         term, p, std::move(state))
+                                  .then([p] { p->loading = false; });
+                            });
+                      });
+                });
             })
             .finally([unit = std::move(unit)] {});
       });
 }
 
+ss::future<group_manager::recovery_start>
+group_manager::load_snapshot(ss::lw_shared_ptr<attached_partition> p) {
+    recovery_start start{.next_offset = p->partition->raft_start_offset()};
+    if (_snapshot_interval() == 0ms) {
+        co_return start;
+    }
+
+    std::optional<cluster::stm_snapshot> snapshot;
+    try {
+        auto units = co_await p->snapshot_lock.get_units();
+        snapshot = co_await p->snapshot.load_snapshot();
+    } catch (...) {
+        vlog(
+          p->snapshot_log.warn,
+          "Failed to load group state snapshot {}: {}",
+          p->snapshot.store_path(),
+          std::current_exception());
+        co_return start;
+    }
+    if (!snapshot) {
+        co_return start;
+    }
+
+    /*
+     * the snapshot is only usable if the log continues right after it. it
+     * doesn't when the log was prefix truncated past the snapshot, or when
+     * the partition was recreated from scratch.
+     */
+    const auto offset = snapshot->header.offset;
+    if (
+      snapshot->header.version != group_snapshot_version
+      || model::next_offset(offset) < start.next_offset
+      || offset > p->partition->dirty_offset()) {
+        vlog(
+          p->snapshot_log.info,
+          "Ignoring group state snapshot at offset {} version {}, log offsets "
+          "[{}, {}]",
+          offset,
+          snapshot->header.version,
+          start.next_offset,
+          p->partition->dirty_offset());
+        co_return start;
+    }
+
+    try {
+        start.state = deserialize_group_snapshot(std::move(snapshot->data));
+    } catch (...) {
+        vlog(
+          p->snapshot_log.warn,
+          "Failed to decode group state snapshot {}: {}",
+          p->snapshot.store_path(),
+          std::current_exception());
+        co_return start;
+    }
+    vlog(
+      p->snapshot_log.debug,
+      "Loaded group state snapshot at offset {} with {} groups",
+      offset,
+      start.state.groups.size());
+    start.next_offset = model::next_offset(offset);
+    co_return start;
+}
+
+ss::future<> group_manager::take_snapshots() {
+    std::vector<ss::lw_shared_ptr<attached_partition>> partitions;
+    partitions.reserve(_partitions.size());
+    for (auto& [_, p] : _partitions) {
+        partitions.push_back(p);
+    }
+    for (auto& p : partitions) {
+        if (_gate.is_closed() || p->as.abort_requested()) {
+            continue;
+        }
+        try {
+            co_await take_snapshot(p);
+        } catch (...) {
+            vlog(
+              p->snapshot_log.warn,
+              "Failed to snapshot group state: {}",
+              std::current_exception());
+        }
+    }
+}
+
+ss::future<>
+group_manager::take_snapshot(ss::lw_shared_ptr<attached_partition> p) {
+    auto start = co_await load_snapshot(p);
+    // only committed batches, the rest of the log may still be truncated
+    const auto committed = p->partition->committed_offset();
+    if (committed < start.next_offset) {
+        co_return;
+    }
+
+    storage::log_reader_config reader_config(
+      start.next_offset,
+      committed,
+      0,
+      std::numeric_limits<size_t>::max(),
+      kafka_read_priority(),
+      std::nullopt,
+      std::nullopt,
+      std::nullopt);
+    auto reader = co_await p->partition->make_reader(reader_config);
+    auto state = co_await std::move(reader).consume(
+      group_recovery_consumer(
+        _serializer_factory(), p->as, std::move(start.state)),
+      model::no_timeout);
+    if (p->as.abort_requested()) {
+        co_return;
+    }
+
+    auto data = serialize_group_snapshot(state);
+    vlog(
+      p->snapshot_log.debug,
+      "Snapshotting group state at offset {}: {} groups, {} bytes",
+      committed,
+      state.groups.size(),
+      data.size_bytes());
+    auto units = co_await p->snapshot_lock.get_units();
+    co_await p->snapshot.persist_local_snapshot(cluster::stm_snapshot::create(
+      group_snapshot_version, committed, std::move(data)));
+}
+
 /*
  * TODO: this routine can be improved from a copy vs move perspective, but is
  * rather complicated at the moment to start having to also analyze all the data
@@ -747,6 +907,7 @@ ss::future<> group_manager::do_recover_group(
               _conf,
               p->catchup_lock,
               p->partition,
+              p->commit_batcher,
               term,
               _tx_frontend,
               _feature_table,
@@ -817,7 +978,7 @@ ss::future<> group_manager::write_version_fence(
         auto reader = model::make_memory_record_batch_reader(std::move(batch));
 
         try {
-            auto result = co_await p->partition->raft()->replicate(
+            auto result = co_await p->commit_batcher->replicate_after_commits(
               term,
               std::move(reader),
               raft::replicate_options(raft::consistency_level::quorum_ack));
@@ -948,6 +1109,7 @@ group::join_group_stages group_manager::join_group(join_group_request&& r) {
           _conf,
           it->second->catchup_lock,
           p,
+          it->second->commit_batcher,
           it->second->term,
           _tx_frontend,
           _feature_table,
@@ -1097,6 +1259,7 @@ group_manager::txn_offset_commit(txn_offset_commit_request&& r) {
                 _conf,
                 p->catchup_lock,
                 p->partition,
+                p->commit_batcher,
                 p->term,
                 _tx_frontend,
                 _feature_table,
@@ -1184,6 +1347,7 @@ group_manager::begin_tx(cluster::begin_group_tx_request&& r) {
                 _conf,
                 p->catchup_lock,
                 p->partition,
+                p->commit_batcher,
                 p->term,
                 _tx_frontend,
                 _feature_table,
@@ -1255,6 +1419,7 @@ group_manager::offset_commit(offset_commit_request&& r) {
               _conf,
               p->catchup_lock,
               p->partition,
+              p->commit_batcher,
               p->term,
               _tx_frontend,
               _feature_table,
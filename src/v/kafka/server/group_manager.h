@@ -11,6 +11,8 @@
 
 #pragma once
 #include "cluster/fwd.h"
+#include "cluster/persisted_stm.h"
+#include "cluster/types.h"
 #include "kafka/protocol/delete_groups.h"
 #include "kafka/protocol/describe_groups.h"
 #include "kafka/protocol/errors.h"
@@ -26,12 +28,16 @@
 #include "kafka/server/group.h"
 #include "kafka/server/group_recovery_consumer.h"
 #include "kafka/server/group_stm.h"
+#include "kafka/server/logger.h"
 #include "kafka/server/member.h"
 #include "model/metadata.h"
 #include "model/namespace.h"
 #include "raft/group_manager.h"
 #include "seastarx.h"
 #include "ssx/semaphore.h"
+#include "ssx/sformat.h"
+#include "utils/mutex.h"
+#include "utils/prefix_logger.h"
 #include "utils/rwlock.h"
 
 #include <seastar/core/abort_source.hh>
@@ -100,7 +106,10 @@ namespace kafka {
  * - Recovery occurs when the local node is leader, else unload (below)
  *
  * The recovery process reads the entire log and deduplicates entries into the
- * `recovery_batch_consumer` object.
+ * `recovery_batch_consumer` object. When group state snapshots are enabled,
+ * recovery starts from the local snapshot and only reads the log after it.
+ * Snapshots are taken periodically on every replica, leader or not, from the
+ * committed part of the log.
  *
  * After the log is read the deduplicated state is used to re-populate the
  * in-memory cache of groups/commits through.
@@ -208,15 +217,35 @@ private:
         ss::abort_source as;
         ss::lw_shared_ptr<cluster::partition> partition;
         ss::lw_shared_ptr<ssx::rwlock> catchup_lock;
+        ss::lw_shared_ptr<offset_commit_batcher> commit_batcher;
         model::term_id term{-1};
-
-        explicit attached_partition(ss::lw_shared_ptr<cluster::partition> p)
+        prefix_logger snapshot_log;
+        // local snapshot of the recovered group state, see group_snapshot.h
+        cluster::file_backed_stm_snapshot snapshot;
+        mutex snapshot_lock;
+
+        attached_partition(
+          ss::lw_shared_ptr<cluster::partition> p,
+          config::binding<std::chrono::milliseconds> commit_linger)
           : loading(true)
-          , partition(std::move(p)) {
+          , partition(std::move(p))
+          , snapshot_log(klog, ssx::sformat("[{}]", partition->ntp()))
+          , snapshot(
+              cluster::group_state_snapshot,
+              snapshot_log,
+              partition->raft().get()) {
             catchup_lock = ss::make_lw_shared<ssx::rwlock>();
+            commit_batcher = ss::make_lw_shared<offset_commit_batcher>(
+              partition, std::move(commit_linger));
         }
     };
 
+    // Where group recovery of a partition starts from
+    struct recovery_start {
+        model::offset next_offset;
+        group_recovery_consumer_state state;
+    };
+
     cluster::notification_id_type _leader_notify_handle;
     cluster::notification_id_type _topic_table_notify_handle;
 
@@ -254,6 +283,17 @@ private:
 
     ss::future<> gc_partition_state(ss::lw_shared_ptr<attached_partition>);
 
+    /// Load the group state snapshot of a partition, if there is a usable
+    /// one. Recovery starts from the beginning of the log otherwise.
+    ss::future<recovery_start>
+      load_snapshot(ss::lw_shared_ptr<attached_partition>);
+
+    /// Fold the committed log written since the last snapshot of each
+    /// partition into a new snapshot.
+    ss::future<> take_snapshots();
+    ss::future<> take_snapshot(ss::lw_shared_ptr<attached_partition>);
+    void arm_snapshot_timer();
+
     ss::future<std::error_code> inject_noop(
       ss::lw_shared_ptr<cluster::partition> p,
       ss::lowres_clock::time_point timeout);
@@ -293,6 +333,8 @@ private:
     model::broker _self;
     enable_group_metrics _enable_group_metrics;
     config::binding<std::chrono::milliseconds> _offset_retention_check;
+    config::binding<std::chrono::milliseconds> _snapshot_interval;
+    ss::timer<> _snapshot_timer;
 };
 
 } // namespace kafka
@@ -45,6 +45,18 @@ public:
       : _serializer(std::move(serializer))
       , _as(as) {}
 
+    /*
+     * Continue the recovery from a state recovered earlier, e.g. loaded from
+     * a snapshot, with the log that follows it.
+     */
+    group_recovery_consumer(
+      group_metadata_serializer serializer,
+      ss::abort_source& as,
+      group_recovery_consumer_state state)
+      : _state(std::move(state))
+      , _serializer(std::move(serializer))
+      , _as(as) {}
+
     ss::future<ss::stop_iteration> operator()(model::record_batch batch);
 
     group_recovery_consumer_state end_of_stream() { return std::move(_state); }
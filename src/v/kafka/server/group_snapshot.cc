@@ -0,0 +1,236 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "kafka/server/group_snapshot.h"
+
+#include "kafka/protocol/wire.h"
+#include "kafka/server/group_metadata.h"
+#include "kafka/server/group_stm.h"
+#include "model/fundamental.h"
+#include "model/record.h"
+#include "serde/envelope.h"
+#include "serde/serde.h"
+
+#include <optional>
+#include <vector>
+
+namespace kafka {
+
+namespace {
+
+/*
+ * Group metadata and committed offsets are stored in the consumer offsets
+ * format, the same as in the log, so that a snapshot can't hold anything the
+ * log couldn't have.
+ */
+template<typename T>
+iobuf encode_metadata(const T& t) {
+    iobuf buffer;
+    protocol::encoder writer(buffer);
+    T::encode(writer, t);
+    return buffer;
+}
+
+template<typename T>
+T decode_metadata(iobuf buffer) {
+    protocol::decoder reader(std::move(buffer));
+    return T::decode(reader);
+}
+
+struct snapshot_offset
+  : serde::
+      envelope<snapshot_offset, serde::version<0>, serde::compat_version<0>> {
+    model::topic topic;
+    model::partition_id partition;
+    model::offset log_offset;
+    iobuf value;
+    bool non_reclaimable{true};
+};
+
+struct snapshot_prepared_offset
+  : serde::envelope<
+      snapshot_prepared_offset,
+      serde::version<0>,
+      serde::compat_version<0>> {
+    model::topic topic;
+    model::partition_id partition;
+    model::offset log_offset;
+    model::offset offset;
+    ss::sstring metadata;
+    kafka::leader_epoch committed_leader_epoch;
+    model::timestamp commit_timestamp;
+    std::optional<model::timestamp> expiry_timestamp;
+    bool non_reclaimable{false};
+};
+
+struct snapshot_prepared_tx
+  : serde::envelope<
+      snapshot_prepared_tx,
+      serde::version<0>,
+      serde::compat_version<0>> {
+    model::producer_identity pid;
+    model::tx_seq tx_seq;
+    std::vector<snapshot_prepared_offset> offsets;
+};
+
+struct snapshot_fence
+  : serde::
+      envelope<snapshot_fence, serde::version<0>, serde::compat_version<0>> {
+    model::producer_id id;
+    model::producer_epoch epoch;
+};
+
+struct snapshot_tx
+  : serde::envelope<snapshot_tx, serde::version<0>, serde::compat_version<0>> {
+    model::producer_identity pid;
+    model::tx_seq tx_seq;
+    model::partition_id tm_partition;
+    model::timeout_clock::duration timeout;
+};
+
+struct snapshot_group
+  : serde::
+      envelope<snapshot_group, serde::version<0>, serde::compat_version<0>> {
+    kafka::group_id id;
+    std::optional<iobuf> metadata;
+    std::vector<snapshot_offset> offsets;
+    std::vector<snapshot_prepared_tx> prepared;
+    std::vector<snapshot_fence> fences;
+    std::vector<snapshot_tx> txs;
+};
+
+struct snapshot
+  : serde::envelope<snapshot, serde::version<0>, serde::compat_version<0>> {
+    bool has_offset_retention_feature_fence{false};
+    std::vector<snapshot_group> groups;
+};
+
+snapshot_group to_snapshot(const group_id& id, const group_stm& stm) {
+    snapshot_group g{.id = id};
+    if (stm.is_loaded()) {
+        g.metadata = encode_metadata(stm.get_metadata());
+    }
+    g.offsets.reserve(stm.offsets().size());
+    for (const auto& [tp, md] : stm.offsets()) {
+        g.offsets.push_back(snapshot_offset{
+          .topic = tp.topic,
+          .partition = tp.partition,
+          .log_offset = md.log_offset,
+          .value = encode_metadata(md.metadata),
+          .non_reclaimable = md.metadata.non_reclaimable,
+        });
+    }
+    for (const auto& [_, tx] : stm.prepared_txs()) {
+        snapshot_prepared_tx p{.pid = tx.pid, .tx_seq = tx.tx_seq};
+        for (const auto& [tp, md] : tx.offsets) {
+            p.offsets.push_back(snapshot_prepared_offset{
+              .topic = tp.topic,
+              .partition = tp.partition,
+              .log_offset = md.log_offset,
+              .offset = md.offset,
+              .metadata = md.metadata,
+              .committed_leader_epoch = md.committed_leader_epoch,
+              .commit_timestamp = md.commit_timestamp,
+              .expiry_timestamp = md.expiry_timestamp,
+              .non_reclaimable = md.non_reclaimable,
+            });
+        }
+        g.prepared.push_back(std::move(p));
+    }
+    for (const auto& [id, epoch] : stm.fences()) {
+        g.fences.push_back(snapshot_fence{.id = id, .epoch = epoch});
+    }
+    for (const auto& [pid, info] : stm.tx_data()) {
+        auto timeout = stm.timeouts().find(pid);
+        g.txs.push_back(snapshot_tx{
+          .pid = pid,
+          .tx_seq = info.tx_seq,
+          .tm_partition = info.tm_partition,
+          .timeout = timeout != stm.timeouts().end()
+                       ? timeout->second
+                       : model::timeout_clock::duration{},
+        });
+    }
+    return g;
+}
+
+group_stm from_snapshot(snapshot_group g) {
+    group_stm stm;
+    if (g.metadata) {
+        stm.overwrite_metadata(
+          decode_metadata<group_metadata_value>(std::move(*g.metadata)));
+    }
+    for (auto& o : g.offsets) {
+        auto value = decode_metadata<offset_metadata_value>(std::move(o.value));
+        value.non_reclaimable = o.non_reclaimable;
+        stm.update_offset(
+          model::topic_partition(std::move(o.topic), o.partition),
+          o.log_offset,
+          std::move(value));
+    }
+    for (auto& p : g.prepared) {
+        group::prepared_tx tx{.pid = p.pid, .tx_seq = p.tx_seq};
+        for (auto& o : p.offsets) {
+            tx.offsets.emplace(
+              model::topic_partition(std::move(o.topic), o.partition),
+              group::offset_metadata{
+                .log_offset = o.log_offset,
+                .offset = o.offset,
+                .metadata = std::move(o.metadata),
+                .committed_leader_epoch = o.committed_leader_epoch,
+                .commit_timestamp = o.commit_timestamp,
+                .expiry_timestamp = o.expiry_timestamp,
+                .non_reclaimable = o.non_reclaimable,
+              });
+        }
+        stm.restore_prepared(std::move(tx));
+    }
+    for (const auto& f : g.fences) {
+        stm.try_set_fence(f.id, f.epoch);
+    }
+    for (const auto& tx : g.txs) {
+        stm.restore_tx_data(
+          tx.pid,
+          group_stm::tx_info{
+            .tx_seq = tx.tx_seq, .tm_partition = tx.tm_partition},
+          tx.timeout);
+    }
+    return stm;
+}
+
+} // namespace
+
+iobuf serialize_group_snapshot(const group_recovery_consumer_state& state) {
+    snapshot s{
+      .has_offset_retention_feature_fence
+      = state.has_offset_retention_feature_fence,
+    };
+    s.groups.reserve(state.groups.size());
+    for (const auto& [id, stm] : state.groups) {
+        s.groups.push_back(to_snapshot(id, stm));
+    }
+    return serde::to_iobuf(std::move(s));
+}
+
+group_recovery_consumer_state deserialize_group_snapshot(iobuf buf) {
+    auto s = serde::from_iobuf<snapshot>(std::move(buf));
+    group_recovery_consumer_state state{
+      .has_offset_retention_feature_fence
+      = s.has_offset_retention_feature_fence,
+    };
+    for (auto& g : s.groups) {
+        auto id = g.id;
+        state.groups.emplace(std::move(id), from_snapshot(std::move(g)));
+    }
+    return state;
+}
+
+} // namespace kafka
@@ -0,0 +1,37 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#pragma once
+
+#include "bytes/iobuf.h"
+#include "kafka/server/group_recovery_consumer.h"
+
+namespace kafka {
+
+/*
+ * Local snapshots of the group state recovered from a consumer offsets
+ * partition.
+ *
+ * Recovering a consumer offsets partition means replaying its whole log.
+ * Instead, the group manager periodically folds the committed part of the log
+ * into a snapshot stored next to the partition, and recovery only replays the
+ * log past the snapshot. A snapshot is a serialized
+ * group_recovery_consumer_state, so that recovering from it gives exactly the
+ * state that replaying the same prefix of the log would.
+ */
+
+/// Snapshot version, as recorded in the stm snapshot header
+inline constexpr int8_t group_snapshot_version = 0;
+
+iobuf serialize_group_snapshot(const group_recovery_consumer_state&);
+
+group_recovery_consumer_state deserialize_group_snapshot(iobuf);
+
+} // namespace kafka
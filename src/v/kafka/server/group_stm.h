@@ -114,6 +114,22 @@ public:
         return !_is_removed && (_is_loaded || _offsets.size() > 0);
     }
     bool is_removed() const { return _is_removed; }
+    bool is_loaded() const { return _is_loaded; }
+
+    /// Restore transactional state taken from a snapshot, see
+    /// group_snapshot.h. Replaying the log goes through update_prepared,
+    /// commit, abort and try_set_fence instead.
+    void restore_prepared(group::prepared_tx tx) {
+        auto id = tx.pid.get_id();
+        _prepared_txs[id] = std::move(tx);
+    }
+    void restore_tx_data(
+      model::producer_identity pid,
+      tx_info info,
+      model::timeout_clock::duration timeout) {
+        _tx_data[pid] = info;
+        _timeouts[pid] = timeout;
+    }
 
     const absl::node_hash_map<model::producer_id, group::prepared_tx>&
     prepared_txs() const {
@@ -383,6 +383,32 @@ static ss::future<read_result> do_read_from_ntp(
     co_return result;
 }
 
+ss::future<read_result> read_from_local_leader(
+  cluster::partition_manager& cluster_pm,
+  const model::ktp& ktp,
+  fetch_config config,
+  std::optional<model::timeout_clock::time_point> deadline) {
+    auto kafka_partition = make_partition_proxy(ktp, cluster_pm);
+    if (unlikely(!kafka_partition)) {
+        co_return read_result(error_code::unknown_topic_or_partition);
+    }
+    if (!kafka_partition->is_leader()) {
+        co_return read_result(error_code::not_leader_for_partition);
+    }
+    auto offset_ec = co_await kafka_partition->validate_fetch_offset(
+      config.start_offset,
+      false,
+      default_fetch_timeout + model::timeout_clock::now());
+    if (offset_ec != error_code::none) {
+        co_return read_result(
+          offset_ec,
+          kafka_partition->start_offset(),
+          kafka_partition->high_watermark());
+    }
+    co_return co_await read_from_partition(
+      std::move(*kafka_partition), config, true, deadline);
+}
+
 namespace testing {
 
 ss::future<read_result> read_from_ntp(
@@ -626,18 +652,23 @@ handle_shard_fetch(ss::shard_id shard, op_context& octx, shard_fetch fetch) {
 
     const bool foreign_read = shard != ss::this_shard_id();
 
-    // dispatch to remote core
-    return octx.rctx.partition_manager()
-      .invoke_on(
+    // dispatch to remote core, coalesced with the work other fetch and produce
+    // requests have for the same shard
+    return octx.rctx.server()
+      .local()
+      .dispatcher()
+      .submit_to(
         shard,
-        octx.ssg,
-        [foreign_read, configs = std::move(fetch.requests), &octx](
-          cluster::partition_manager& mgr) mutable {
+        [&pm = octx.rctx.partition_manager(),
+         foreign_read,
+         configs = std::move(fetch.requests),
+         &octx]() mutable {
             // &octx is captured only to immediately use its accessors here so
-            // that there is a list of all objects accessed next to `invoke_on`.
-            // This is meant to help avoiding unintended cross shard access
+            // that there is a list of all objects accessed next to
+            // `submit_to`. This is meant to help avoiding unintended cross
+            // shard access
             return fetch_ntps_in_parallel(
-              mgr,
+              pm.local(),
               octx.rctx.server().local().get_replica_selector(),
               std::move(configs),
               foreign_read,
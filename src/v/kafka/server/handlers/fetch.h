@@ -388,6 +388,17 @@ struct fetch_plan {
     }
 };
 
+/**
+ * Reads a partition led by this shard outside of a fetch request, as the HTTP
+ * proxy does when it runs inside the broker. Runs on the ntp's home core. No
+ * fetch memory is reserved, the read is bounded by the config's max_bytes.
+ */
+ss::future<read_result> read_from_local_leader(
+  cluster::partition_manager&,
+  const model::ktp&,
+  fetch_config,
+  std::optional<model::timeout_clock::time_point>);
+
 /*
  * Unit Tests Exposure
  */
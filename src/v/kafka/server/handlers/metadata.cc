@@ -294,11 +294,11 @@ static ss::future<std::vector<metadata_response::topic>> get_topic_metadata(
               std::move(topic.name), error_code::topic_authorization_failed));
             continue;
         }
-        if (auto md = ctx.metadata_cache().get_topic_metadata(
+        if (auto md = ctx.metadata_cache().get_topic_metadata_ref(
               model::topic_namespace_view(model::kafka_namespace, topic.name));
             md) {
             auto src_topic_response = make_topic_response(
-              ctx, request, *md, is_node_isolated);
+              ctx, request, md->get(), is_node_isolated);
             src_topic_response.name = std::move(topic.name);
             res.push_back(std::move(src_topic_response));
             continue;
@@ -218,17 +218,58 @@ static partition_produce_stages partition_append(
     };
 }
 
+ss::future<produce_response::partition> produce_to_local_leader(
+  cluster::partition_manager& pm,
+  const model::ntp& ntp,
+  model::batch_identity bid,
+  model::record_batch_reader reader,
+  int64_t num_bytes,
+  uint32_t batch_max_bytes,
+  int16_t acks,
+  std::chrono::milliseconds timeout) {
+    auto partition = pm.get(ntp);
+    auto error = error_code::none;
+    if (!partition || !partition->is_leader()) {
+        error = error_code::not_leader_for_partition;
+    } else if (unlikely(static_cast<uint64_t>(num_bytes) > batch_max_bytes)) {
+        error = error_code::message_too_large;
+    } else if (partition->is_read_replica_mode_enabled()) {
+        error = error_code::invalid_topic_exception;
+    }
+    if (error != error_code::none) {
+        return ss::make_ready_future<produce_response::partition>(
+          produce_response::partition{
+            .partition_index = ntp.tp.partition, .error_code = error});
+    }
+
+    auto stages = partition_append(
+      ntp.tp.partition,
+      ss::make_lw_shared<replicated_partition>(std::move(partition)),
+      bid,
+      std::move(reader),
+      acks,
+      bid.record_count,
+      num_bytes,
+      timeout);
+    return stages.dispatched.then_wrapped(
+      [f = std::move(stages.produced)](ss::future<> dispatched) mutable {
+          // a failed dispatch is reported through the produced stage
+          dispatched.ignore_ready_future();
+          return std::move(f);
+      });
+}
+
 ss::future<produce_response::partition> finalize_request_with_error_code(
   error_code ec,
   std::unique_ptr<ss::promise<>> dispatch,
   model::ntp ntp,
-  ss::shard_id source_shard) {
+  ss::shard_id source_shard,
+  ssx::smp_dispatcher<server>& dispatcher) {
     // submit back to promise source shard
-    ssx::background = ss::smp::submit_to(
-      source_shard, [dispatch = std::move(dispatch)]() mutable {
-          dispatch->set_value();
-          dispatch.reset();
-      });
+    dispatcher.post(source_shard, [dispatch = std::move(dispatch)]() mutable {
+        dispatch->set_value();
+        dispatch.reset();
+    });
     return ss::make_ready_future<produce_response::partition>(
       produce_response::partition{
         .partition_index = ntp.tp.partition, .error_code = ec});
@@ -337,18 +378,21 @@ static partition_produce_stages produce_topic_partition(
     // steal the batch from the adapter
     auto batch = std::move(part.records->adapter.batch.value());
 
-    auto topic_cfg = octx.rctx.metadata_cache().get_topic_cfg(
+    // the topic metadata is referenced, not copied, it must not be used past
+    // the first scheduling point
+    auto topic_md = octx.rctx.metadata_cache().get_topic_metadata_ref(
       model::topic_namespace_view(model::kafka_namespace, topic.name));
 
-    if (!topic_cfg) {
+    if (!topic_md) {
         return make_ready_stage(produce_response::partition{
           .partition_index = ntp.tp.partition,
           .error_code = error_code::unknown_topic_or_partition});
     }
+    const auto& topic_cfg = topic_md->get().get_configuration();
 
-    const auto timestamp_type = topic_cfg->properties.timestamp_type.value_or(
+    const auto timestamp_type = topic_cfg.properties.timestamp_type.value_or(
       octx.rctx.metadata_cache().get_default_timestamp_type());
-    const auto batch_max_bytes = topic_cfg->properties.batch_max_bytes.value_or(
+    const auto batch_max_bytes = topic_cfg.properties.batch_max_bytes.value_or(
       octx.rctx.metadata_cache().get_default_batch_max_bytes());
 
     // validate the batch timestamps by checking skew against broker time
@@ -366,18 +410,21 @@ static partition_produce_stages produce_topic_partition(
     auto reader = reader_from_lcore_batch(std::move(batch));
     auto validator
       = pandaproxy::schema_registry::maybe_make_schema_id_validator(
-        octx.rctx.schema_registry(), topic.name, topic_cfg->properties);
+        octx.rctx.schema_registry(), topic.name, topic_cfg.properties);
     auto start = std::chrono::steady_clock::now();
 
     auto dispatch = std::make_unique<ss::promise<>>();
     auto dispatch_f = dispatch->get_future();
     auto m = octx.rctx.probe().auto_produce_measurement();
     auto f
-      = octx.rctx.partition_manager()
-          .invoke_on(
+      = octx.rctx.server()
+          .local()
+          .dispatcher()
+          .submit_to(
             *shard,
-            octx.ssg,
-            [reader = std::move(reader),
+            [&pm = octx.rctx.partition_manager(),
+             &srv = octx.rctx.server(),
+             reader = std::move(reader),
              validator = std::move(validator),
              ntp = std::move(ntp),
              dispatch = std::move(dispatch),
@@ -387,15 +434,16 @@ static partition_produce_stages produce_topic_partition(
              acks = octx.request.data.acks,
              batch_max_bytes,
              timeout = octx.request.data.timeout_ms,
-             source_shard = ss::this_shard_id()](
-              cluster::partition_manager& mgr) mutable {
-                auto partition = mgr.get(ntp);
+             source_shard = ss::this_shard_id()]() mutable {
+                auto& dispatcher = srv.local().dispatcher();
+                auto partition = pm.local().get(ntp);
                 if (!partition) {
                     return finalize_request_with_error_code(
                       error_code::not_leader_for_partition,
                       std::move(dispatch),
                       ntp,
-                      source_shard);
+                      source_shard,
+                      dispatcher);
                 }
                 if (unlikely(
                       static_cast<uint32_t>(batch_size) > batch_max_bytes)) {
@@ -403,21 +451,24 @@ static partition_produce_stages produce_topic_partition(
                       error_code::message_too_large,
                       std::move(dispatch),
                       ntp,
-                      source_shard);
+                      source_shard,
+                      dispatcher);
                 }
                 if (unlikely(!partition->is_leader())) {
                     return finalize_request_with_error_code(
                       error_code::not_leader_for_partition,
                       std::move(dispatch),
                       ntp,
-                      source_shard);
+                      source_shard,
+                      dispatcher);
                 }
                 if (partition->is_read_replica_mode_enabled()) {
                     return finalize_request_with_error_code(
                       error_code::invalid_topic_exception,
                       std::move(dispatch),
                       ntp,
-                      source_shard);
+                      source_shard,
+                      dispatcher);
                 }
 
                 auto probe = std::addressof(partition->probe());
@@ -426,6 +477,7 @@ static partition_produce_stages produce_topic_partition(
                   .then([ntp{std::move(ntp)},
                          partition{std::move(partition)},
                          dispatch = std::move(dispatch),
+                         &dispatcher,
                          bid,
                          acks,
                          source_shard,
@@ -437,7 +489,8 @@ static partition_produce_stages produce_topic_partition(
                             reader.assume_error(),
                             std::move(dispatch),
                             ntp,
-                            source_shard);
+                            source_shard,
+                            dispatcher);
                       }
                       auto stages = partition_append(
                         ntp.tp.partition,
@@ -451,10 +504,12 @@ static partition_produce_stages produce_topic_partition(
                         timeout);
                       return stages.dispatched
                         .then_wrapped(
-                          [source_shard, dispatch = std::move(dispatch)](
+                          [source_shard,
+                           &dispatcher,
+                           dispatch = std::move(dispatch)](
                             ss::future<> f) mutable {
                               if (f.failed()) {
-                                  (void)ss::smp::submit_to(
+                                  dispatcher.post(
                                     source_shard,
                                     [dispatch = std::move(dispatch),
                                      e = f.get_exception()]() mutable {
@@ -463,7 +518,7 @@ static partition_produce_stages produce_topic_partition(
                                     });
                                   return;
                               }
-                              (void)ss::smp::submit_to(
+                              dispatcher.post(
                                 source_shard,
                                 [dispatch = std::move(dispatch)]() mutable {
                                     dispatch->set_value();
@@ -9,11 +9,29 @@
  * by the Apache License, Version 2.0
  */
 #pragma once
+#include "cluster/fwd.h"
 #include "kafka/protocol/produce.h"
 #include "kafka/server/handlers/handler.h"
+#include "model/record_batch_reader.h"
 
 namespace kafka {
 
 using produce_handler = two_phase_handler<produce_api, 0, 7>;
 
+/**
+ * Appends to a partition led by this shard outside of a produce request, as
+ * the HTTP proxy does when it runs inside the broker. Runs on the ntp's home
+ * core and applies the checks of the produce handler, except for schema id
+ * validation which is left to the caller.
+ */
+ss::future<produce_response::partition> produce_to_local_leader(
+  cluster::partition_manager&,
+  const model::ntp&,
+  model::batch_identity,
+  model::record_batch_reader,
+  int64_t num_bytes,
+  uint32_t batch_max_bytes,
+  int16_t acks,
+  std::chrono::milliseconds timeout);
+
 } // namespace kafka
@@ -0,0 +1,132 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#include "kafka/server/offset_commit_batcher.h"
+
+#include "cluster/partition.h"
+#include "cluster/simple_batch_builder.h"
+#include "model/record_batch_reader.h"
+#include "raft/errc.h"
+#include "ssx/future-util.h"
+
+#include <seastar/core/coroutine.hh>
+
+namespace kafka {
+
+offset_commit_batcher::offset_commit_batcher(
+  ss::lw_shared_ptr<cluster::partition> partition,
+  config::binding<std::chrono::milliseconds> linger)
+  : _partition(std::move(partition))
+  , _linger(std::move(linger)) {
+    _flush_timer.set_callback([this] { flush(); });
+}
+
+offset_commit_batcher::~offset_commit_batcher() noexcept {
+    _flush_timer.cancel();
+    if (_pending) {
+        // The partition is gone, nothing is going to replicate the batch
+        _pending->enqueued.set_value();
+        _pending->finished.set_value(result<raft::replicate_result>(
+          raft::make_error_code(raft::errc::shutting_down)));
+    }
+}
+
+raft::replicate_stages offset_commit_batcher::replicate(
+  model::term_id term, std::vector<key_value> records) {
+    if (_pending && _pending->term != term) {
+        flush();
+    }
+    if (!_pending) {
+        _pending = ss::make_lw_shared<pending_batch>();
+        _pending->term = term;
+    }
+    for (auto& r : records) {
+        _pending->size_bytes += r.key.size_bytes();
+        if (r.value) {
+            _pending->size_bytes += r.value->size_bytes();
+        }
+        _pending->records.push_back(std::move(r));
+    }
+
+    raft::replicate_stages stages(
+      _pending->enqueued.get_shared_future(),
+      _pending->finished.get_shared_future());
+
+    auto linger = _linger();
+    if (
+      linger == std::chrono::milliseconds(0)
+      || _pending->size_bytes >= max_batch_bytes) {
+        flush();
+    } else if (!_flush_timer.armed()) {
+        _flush_timer.arm(linger);
+    }
+    return stages;
+}
+
+ss::future<result<raft::replicate_result>>
+offset_commit_batcher::replicate_after_commits(
+  model::term_id term,
+  model::record_batch_reader reader,
+  raft::replicate_options opts) {
+    flush();
+    if (_last_flushed) {
+        // Only the order matters here, a commit that failed to be enqueued is
+        // reported to its own caller.
+        co_await _last_flushed->enqueued.get_shared_future().handle_exception(
+          [](const std::exception_ptr&) {});
+    }
+    co_return co_await _partition->raft()->replicate(
+      term, std::move(reader), opts);
+}
+
+void offset_commit_batcher::flush() {
+    _flush_timer.cancel();
+    if (!_pending) {
+        return;
+    }
+    auto pending = std::exchange(_pending, nullptr);
+    _last_flushed = pending;
+
+    cluster::simple_batch_builder builder(
+      model::record_batch_type::raft_data, model::offset(0));
+    for (auto& r : pending->records) {
+        builder.add_raw_kv(std::move(r.key), std::move(r.value));
+    }
+    pending->records.clear();
+
+    auto stages = _partition->raft()->replicate_in_stages(
+      pending->term,
+      model::make_memory_record_batch_reader(std::move(builder).build()),
+      raft::replicate_options(raft::consistency_level::quorum_ack));
+
+    // The continuations only hold the pending batch, the batcher may go away
+    // before the batch is replicated.
+    ssx::background = std::move(stages.request_enqueued)
+                        .then_wrapped([pending](ss::future<> f) {
+                            if (f.failed()) {
+                                pending->enqueued.set_exception(
+                                  f.get_exception());
+                            } else {
+                                pending->enqueued.set_value();
+                            }
+                        });
+    ssx::background
+      = std::move(stages.replicate_finished)
+          .then_wrapped(
+            [pending](ss::future<result<raft::replicate_result>> f) {
+                if (f.failed()) {
+                    pending->finished.set_exception(f.get_exception());
+                } else {
+                    pending->finished.set_value(f.get());
+                }
+            });
+}
+
+} // namespace kafka
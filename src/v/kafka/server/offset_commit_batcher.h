@@ -0,0 +1,94 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#pragma once
+
+#include "cluster/fwd.h"
+#include "config/property.h"
+#include "kafka/server/group_metadata.h"
+#include "model/fundamental.h"
+#include "model/record_batch_reader.h"
+#include "raft/types.h"
+#include "seastarx.h"
+#include "units.h"
+
+#include <seastar/core/shared_future.hh>
+#include <seastar/core/shared_ptr.hh>
+#include <seastar/core/timer.hh>
+
+#include <chrono>
+#include <vector>
+
+namespace kafka {
+
+/*
+ * Coalesces the offset commits of all the groups of a consumer offsets
+ * partition into shared raft batches.
+ *
+ * Offset commits are small and frequent, replicating each of them as its own
+ * batch makes the consumer offsets partitions write mostly batch headers.
+ * Instead, commits are appended to a pending batch which is replicated once
+ * the linger time elapsed since its first commit, or once it is full. Every
+ * commit of a batch observes the replication stages of the whole batch.
+ *
+ * Records are only ever coalesced within a term. With a linger time of zero
+ * each commit is replicated right away, as its own batch.
+ *
+ * Every other write to the partition goes through replicate_after_commits()
+ * so that it is not overtaken by commits accepted before it, e.g. a group
+ * tombstone landing in the log ahead of a lingering commit of that group.
+ */
+class offset_commit_batcher {
+public:
+    using key_value = group_metadata_serializer::key_value;
+
+    offset_commit_batcher(
+      ss::lw_shared_ptr<cluster::partition>,
+      config::binding<std::chrono::milliseconds> linger);
+
+    offset_commit_batcher(const offset_commit_batcher&) = delete;
+    offset_commit_batcher& operator=(const offset_commit_batcher&) = delete;
+    offset_commit_batcher(offset_commit_batcher&&) = delete;
+    offset_commit_batcher& operator=(offset_commit_batcher&&) = delete;
+    ~offset_commit_batcher() noexcept;
+
+    /// Replicate \p records in term \p term, as part of the next batch.
+    raft::replicate_stages
+    replicate(model::term_id term, std::vector<key_value> records);
+
+    /// Replicate \p reader right away, ordered after every commit passed to
+    /// replicate() before it.
+    ss::future<result<raft::replicate_result>> replicate_after_commits(
+      model::term_id term,
+      model::record_batch_reader reader,
+      raft::replicate_options opts);
+
+private:
+    static constexpr size_t max_batch_bytes = 512_KiB;
+
+    struct pending_batch {
+        model::term_id term;
+        std::vector<key_value> records;
+        size_t size_bytes{0};
+        ss::shared_promise<> enqueued;
+        ss::shared_promise<result<raft::replicate_result>> finished;
+    };
+
+    void flush();
+
+    ss::lw_shared_ptr<cluster::partition> _partition;
+    config::binding<std::chrono::milliseconds> _linger;
+    ss::lw_shared_ptr<pending_batch> _pending;
+    // most recently replicated batch, later writes wait for it to be enqueued
+    ss::lw_shared_ptr<pending_batch> _last_flushed;
+    ss::timer<> _flush_timer;
+};
+
+} // namespace kafka
@@ -105,6 +105,7 @@ server::server(
   const std::unique_ptr<pandaproxy::schema_registry::api>& sr) noexcept
   : net::server(cfg, klog)
   , _smp_group(smp)
+  , _dispatcher(*this, smp)
   , _fetch_scheduling_group(fetch_sg)
   , _topics_frontend(tf)
   , _config_frontend(cf)
@@ -156,6 +157,11 @@ server::server(
     _probe->setup_public_metrics();
 }
 
+ss::future<> server::stop() {
+    co_await net::server::stop();
+    co_await _dispatcher.stop();
+}
+
 void server::setup_metrics() {
     namespace sm = ss::metrics;
     if (config::shard_local_cfg().disable_metrics()) {
@@ -30,6 +30,7 @@
 #include "security/mtls.h"
 #include "ssx/fwd.h"
 #include "ssx/metrics.h"
+#include "ssx/smp_dispatcher.h"
 #include "utils/ema.h"
 
 #include <seastar/core/future.hh>
@@ -75,12 +76,21 @@ public:
     server& operator=(server&&) noexcept = delete;
 
     std::string_view name() const final { return "kafka rpc protocol"; }
+    ss::future<> stop();
     // the lifetime of all references here are guaranteed to live
     // until the end of the server (container/parent)
     ss::future<> apply(ss::lw_shared_ptr<net::connection>) final;
 
     ss::smp_service_group smp_group() const { return _smp_group; }
 
+    /**
+     * @brief Cross shard dispatcher for request handlers.
+     *
+     * Per partition work sent to other shards by concurrent requests is
+     * coalesced into one smp message per destination shard and poll.
+     */
+    ssx::smp_dispatcher<server>& dispatcher() { return _dispatcher; }
+
     /**
      * @brief Return the scheduling group to use for fetch requests.
      *
@@ -190,6 +200,7 @@ private:
     void setup_metrics();
 
     ss::smp_service_group _smp_group;
+    ssx::smp_dispatcher<server> _dispatcher;
     ss::scheduling_group _fetch_scheduling_group;
     ss::sharded<cluster::topics_frontend>& _topics_frontend;
     ss::sharded<cluster::config_frontend>& _config_frontend;
@@ -8,25 +8,39 @@
 // by the Apache License, Version 2.0
 
 #include "cluster/controller_api.h"
+#include "cluster/partition_manager.h"
+#include "cluster/types.h"
+#include "config/configuration.h"
 #include "features/feature_table.h"
 #include "kafka/client/client.h"
+#include "kafka/protocol/delete_groups.h"
 #include "kafka/protocol/describe_groups.h"
 #include "kafka/protocol/errors.h"
 #include "kafka/protocol/find_coordinator.h"
 #include "kafka/protocol/join_group.h"
+#include "kafka/protocol/offset_commit.h"
+#include "kafka/protocol/offset_fetch.h"
 #include "kafka/protocol/schemata/join_group_request.h"
+#include "kafka/server/group_metadata.h"
+#include "kafka/server/offset_commit_batcher.h"
 #include "kafka/types.h"
 #include "model/fundamental.h"
 #include "model/namespace.h"
+#include "model/record_batch_reader.h"
 #include "model/timeout_clock.h"
+#include "raft/errc.h"
 #include "redpanda/tests/fixture.h"
 #include "test_utils/async.h"
 
+#include <seastar/core/seastar.hh>
+#include <seastar/core/sleep.hh>
 #include <seastar/core/smp.hh>
 #include <seastar/core/sstring.hh>
 
 #include <boost/test/tools/old/interface.hpp>
 
+#include <filesystem>
+
 using namespace kafka;
 join_group_request make_join_group_request(
   ss::sstring member_id,
@@ -100,6 +114,220 @@ FIXTURE_TEST(join_empty_group_static_member, consumer_offsets_fixture) {
     }).get();
 }
 
+FIXTURE_TEST(coalesced_offset_commits, consumer_offsets_fixture) {
+    // Concurrent commits of groups that share a coordinator partition end up
+    // in the same batch while they linger. A single consumer offsets
+    // partition makes all the groups share it.
+    config::shard_local_cfg().group_offset_commit_linger_ms.set_value(
+      std::chrono::milliseconds(500));
+    config::shard_local_cfg().group_topic_partitions.set_value(1);
+    auto reset_cfg = ss::defer([] {
+        config::shard_local_cfg().group_offset_commit_linger_ms.reset();
+        config::shard_local_cfg().group_topic_partitions.reset();
+    });
+
+    model::topic topic("coalesced");
+    add_topic(model::topic_namespace_view(model::kafka_namespace, topic)).get();
+    wait_for_consumer_offsets_topic(kafka::group_instance_id("instance-1"));
+
+    constexpr int group_count = 5;
+    std::vector<kafka::client::transport> clients;
+    for (int i = 0; i < group_count; ++i) {
+        clients.push_back(make_kafka_client().get0());
+        clients.back().connect().get();
+    }
+    auto deferred = ss::defer([&clients] {
+        for (auto& client : clients) {
+            client.stop().then([&client] { client.shutdown(); }).get();
+        }
+    });
+
+    auto group_name = [](int i) {
+        return kafka::group_id(fmt::format("coalesced-{}", i));
+    };
+
+    tests::cooperative_spin_wait_with_timeout(30s, [&] {
+        std::vector<ss::future<offset_commit_response>> commits;
+        for (int i = 0; i < group_count; ++i) {
+            offset_commit_request req;
+            req.data.group_id = group_name(i);
+            req.data.topics.push_back(offset_commit_request_topic{
+              .name = topic,
+              .partitions = {offset_commit_request_partition{
+                .partition_index = model::partition_id(0),
+                .committed_offset = model::offset(i)}}});
+            commits.push_back(
+              clients[i].dispatch(std::move(req), kafka::api_version(2)));
+        }
+        return ss::when_all_succeed(commits.begin(), commits.end())
+          .then([](std::vector<offset_commit_response> responses) {
+              return std::all_of(
+                responses.begin(), responses.end(), [](const auto& r) {
+                    return r.data.topics.size() == 1
+                           && r.data.topics[0].partitions[0].error_code
+                                == kafka::error_code::none;
+                });
+          });
+    }).get();
+
+    for (int i = 0; i < group_count; ++i) {
+        offset_fetch_request req;
+        req.data.group_id = group_name(i);
+        req.data.topics = {offset_fetch_request_topic{
+          .name = topic, .partition_indexes = {model::partition_id(0)}}};
+        auto resp = clients[i].dispatch(std::move(req), kafka::api_version(2))
+                      .get0();
+        BOOST_REQUIRE_EQUAL(resp.data.error_code, kafka::error_code::none);
+        BOOST_REQUIRE_EQUAL(
+          resp.data.topics[0].partitions[0].committed_offset, model::offset(i));
+    }
+
+    // every commit is a single record, a batch holding more than one of them
+    // carries the commits of several groups
+    auto partition = app.partition_manager.local().get(model::ntp(
+      model::kafka_namespace, model::kafka_consumer_offsets_topic, 0));
+    BOOST_REQUIRE(partition);
+    auto reader = partition
+                    ->make_reader(storage::log_reader_config(
+                      model::offset(0),
+                      model::offset::max(),
+                      ss::default_priority_class()))
+                    .get();
+    auto batches = model::consume_reader_to_memory(
+                     std::move(reader), model::no_timeout)
+                     .get();
+    size_t max_commits_per_batch = 0;
+    for (const auto& b : batches) {
+        if (b.header().type == model::record_batch_type::raft_data) {
+            max_commits_per_batch = std::max(
+              max_commits_per_batch, size_t(b.record_count()));
+        }
+    }
+    BOOST_REQUIRE_GT(max_commits_per_batch, 1);
+}
+
+FIXTURE_TEST(offset_commit_batcher_shutdown, consumer_offsets_fixture) {
+    // Commits still lingering when the partition goes away are failed,
+    // rather than left waiting for a batch nobody will replicate.
+    model::topic topic("batcher-shutdown");
+    add_topic(model::topic_namespace_view(model::kafka_namespace, topic)).get();
+    model::ntp ntp(model::kafka_namespace, topic, 0);
+    wait_for_leader(ntp, 10s).get();
+    auto partition = app.partition_manager.local().get(ntp);
+    BOOST_REQUIRE(partition);
+
+    auto batcher = std::make_unique<offset_commit_batcher>(
+      partition, config::mock_binding(std::chrono::milliseconds(10min)));
+    std::vector<offset_commit_batcher::key_value> records;
+    records.push_back({.key = iobuf(), .value = iobuf()});
+    auto stages = batcher->replicate(partition->term(), std::move(records));
+    BOOST_REQUIRE(!stages.replicate_finished.available());
+
+    batcher.reset();
+    stages.request_enqueued.get();
+    auto res = stages.replicate_finished.get();
+    BOOST_REQUIRE(res.has_error());
+    BOOST_REQUIRE_EQUAL(
+      res.error(), raft::make_error_code(raft::errc::shutting_down));
+}
+
+FIXTURE_TEST(
+  lingering_commit_ordered_before_group_delete, consumer_offsets_fixture) {
+    // A commit still lingering in the batcher when its group is deleted must
+    // reach the log before the group tombstone, otherwise recovery brings
+    // the deleted offset back.
+    config::shard_local_cfg().group_offset_commit_linger_ms.set_value(
+      std::chrono::milliseconds(2000));
+    config::shard_local_cfg().group_topic_partitions.set_value(1);
+    auto reset_cfg = ss::defer([] {
+        config::shard_local_cfg().group_offset_commit_linger_ms.reset();
+        config::shard_local_cfg().group_topic_partitions.reset();
+    });
+
+    model::topic topic("commit-then-delete");
+    add_topic(model::topic_namespace_view(model::kafka_namespace, topic)).get();
+    wait_for_consumer_offsets_topic(kafka::group_instance_id("instance-1"));
+
+    auto commit_client = make_kafka_client().get0();
+    auto delete_client = make_kafka_client().get0();
+    commit_client.connect().get();
+    delete_client.connect().get();
+    auto deferred = ss::defer([&commit_client, &delete_client] {
+        for (auto* client : {&commit_client, &delete_client}) {
+            client->stop().then([client] { client->shutdown(); }).get();
+        }
+    });
+
+    kafka::group_id group("commit-then-delete");
+    auto commit = [&](model::offset o) {
+        offset_commit_request req;
+        req.data.group_id = group;
+        req.data.topics.push_back(offset_commit_request_topic{
+          .name = topic,
+          .partitions = {offset_commit_request_partition{
+            .partition_index = model::partition_id(0),
+            .committed_offset = o}}});
+        return commit_client.dispatch(std::move(req), kafka::api_version(2));
+    };
+
+    // the first commit creates the group
+    tests::cooperative_spin_wait_with_timeout(30s, [&] {
+        return commit(model::offset(0)).then([](offset_commit_response r) {
+            return r.data.topics.size() == 1
+                   && r.data.topics[0].partitions[0].error_code
+                        == kafka::error_code::none;
+        });
+    }).get();
+
+    auto lingering = commit(model::offset(1));
+    ss::sleep(200ms).get();
+    BOOST_REQUIRE(!lingering.available());
+
+    delete_groups_request req;
+    req.data.groups_names = {group};
+    auto deleted
+      = delete_client.dispatch(std::move(req), kafka::api_version(0)).get0();
+    BOOST_REQUIRE_EQUAL(deleted.data.results.size(), 1);
+    BOOST_REQUIRE_EQUAL(
+      deleted.data.results[0].error_code, kafka::error_code::none);
+    lingering.get();
+
+    auto partition = app.partition_manager.local().get(model::ntp(
+      model::kafka_namespace, model::kafka_consumer_offsets_topic, 0));
+    BOOST_REQUIRE(partition);
+    auto reader = partition
+                    ->make_reader(storage::log_reader_config(
+                      model::offset(0),
+                      model::offset::max(),
+                      ss::default_priority_class()))
+                    .get();
+    auto batches = model::consume_reader_to_memory(
+                     std::move(reader), model::no_timeout)
+                     .get();
+
+    auto serializer = make_consumer_offsets_serializer();
+    std::optional<model::offset> last_commit;
+    std::optional<model::offset> group_tombstone;
+    for (const auto& b : batches) {
+        if (b.header().type != model::record_batch_type::raft_data) {
+            continue;
+        }
+        b.for_each_record([&](model::record r) {
+            auto o = b.base_offset() + model::offset(r.offset_delta());
+            auto type = serializer.get_metadata_type(r.release_key());
+            if (type == group_metadata_type::offset_commit && r.has_value()) {
+                last_commit = o;
+            } else if (
+              type == group_metadata_type::group_metadata && !r.has_value()) {
+                group_tombstone = o;
+            }
+        });
+    }
+    BOOST_REQUIRE(last_commit.has_value());
+    BOOST_REQUIRE(group_tombstone.has_value());
+    BOOST_REQUIRE_LT(*last_commit, *group_tombstone);
+}
+
 SEASTAR_THREAD_TEST_CASE(consumer_group_decode) {
     {
         // snatched from a log message after a franz-go client joined
@@ -113,3 +341,32 @@ SEASTAR_THREAD_TEST_CASE(consumer_group_decode) {
             {model::topic("t0"), model::topic("t1"), model::topic("t2")}));
     }
 }
+
+FIXTURE_TEST(
+  group_state_snapshot_removed_with_partition, consumer_offsets_fixture) {
+    config::shard_local_cfg().group_state_snapshot_interval_ms.set_value(
+      std::chrono::milliseconds(50));
+    auto reset_cfg = ss::defer([] {
+        config::shard_local_cfg().group_state_snapshot_interval_ms.reset();
+    });
+    wait_for_consumer_offsets_topic(kafka::group_instance_id("instance-1"));
+
+    model::ntp ntp(
+      model::kafka_namespace, model::kafka_consumer_offsets_topic, 0);
+    auto partition = app.partition_manager.local().get(ntp);
+    BOOST_REQUIRE(partition);
+    std::filesystem::path dir(
+      partition->raft()->log_config().work_directory());
+    auto snapshot_path = (dir / cluster::group_state_snapshot).string();
+    tests::cooperative_spin_wait_with_timeout(10s, [&snapshot_path] {
+        return ss::file_exists(snapshot_path);
+    }).get();
+    partition = nullptr;
+
+    // the partition directory can only be removed once the snapshot is gone
+    app.partition_manager.local()
+      .remove(ntp, cluster::partition_removal_mode::local_only)
+      .get();
+    BOOST_REQUIRE(!ss::file_exists(snapshot_path).get());
+    BOOST_REQUIRE(!ss::file_exists(dir.string()).get());
+}
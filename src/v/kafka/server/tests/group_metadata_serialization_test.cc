@@ -10,6 +10,8 @@
 #include "bytes/bytes.h"
 #include "kafka/protocol/wire.h"
 #include "kafka/server/group_metadata.h"
+#include "kafka/server/group_snapshot.h"
+#include "kafka/server/group_stm.h"
 #include "kafka/server/server.h"
 #include "kafka/types.h"
 #include "model/adl_serde.h"
@@ -263,3 +265,72 @@ FIXTURE_TEST(test_unwrapping_tombstones_from_iobuf, fixture) {
         BOOST_REQUIRE_EQUAL(offset_key, iobuf_offset_md_kv.key);
     }
 }
+
+FIXTURE_TEST(test_group_snapshot_roundtrip, fixture) {
+    kafka::group_recovery_consumer_state state;
+    state.has_offset_retention_feature_fence = true;
+
+    auto& stm = state.groups[kafka::group_id("g")];
+    kafka::group_metadata_value group_md;
+    group_md.protocol_type = random_named_string<kafka::protocol_type>();
+    group_md.generation = random_named_int<kafka::generation_id>();
+    group_md.members.push_back(random_member_state());
+    stm.overwrite_metadata(group_md.copy());
+
+    model::topic_partition tp(
+      random_named_string<model::topic>(), model::partition_id(1));
+    kafka::offset_metadata_value offset_md;
+    offset_md.offset = random_named_int<model::offset>();
+    offset_md.leader_epoch = random_named_int<kafka::leader_epoch>();
+    offset_md.metadata = random_named_string<ss::sstring>();
+    offset_md.commit_timestamp = model::timestamp::now();
+    offset_md.non_reclaimable = false;
+    stm.update_offset(
+      tp, model::offset(10), kafka::offset_metadata_value(offset_md));
+
+    model::producer_identity pid(5, 2);
+    stm.try_set_fence(
+      pid.get_id(),
+      pid.get_epoch(),
+      model::tx_seq(3),
+      std::chrono::milliseconds(1000),
+      model::partition_id(0));
+    stm.update_prepared(
+      model::offset(12),
+      kafka::group_log_prepared_tx{
+        .group_id = kafka::group_id("g"),
+        .pid = pid,
+        .tx_seq = model::tx_seq(3),
+        .offsets = {{.tp = tp, .offset = model::offset(20), .leader_epoch = 1}},
+      });
+
+    // offsets only, no group metadata
+    state.groups[kafka::group_id("h")].update_offset(
+      tp, model::offset(11), kafka::offset_metadata_value(offset_md));
+
+    auto decoded = kafka::deserialize_group_snapshot(
+      kafka::serialize_group_snapshot(state));
+
+    BOOST_REQUIRE(decoded.has_offset_retention_feature_fence);
+    BOOST_REQUIRE_EQUAL(decoded.groups.size(), 2);
+
+    const auto& g = decoded.groups.at(kafka::group_id("g"));
+    BOOST_REQUIRE(g.is_loaded());
+    BOOST_REQUIRE_EQUAL(g.get_metadata(), group_md);
+    BOOST_REQUIRE_EQUAL(g.offsets().at(tp).log_offset, model::offset(10));
+    BOOST_REQUIRE_EQUAL(g.offsets().at(tp).metadata, offset_md);
+    BOOST_REQUIRE_EQUAL(g.fences().at(pid.get_id()), pid.get_epoch());
+    BOOST_REQUIRE_EQUAL(g.tx_data().at(pid).tx_seq, model::tx_seq(3));
+    BOOST_REQUIRE(
+      g.timeouts().at(pid)
+      == model::timeout_clock::duration(std::chrono::milliseconds(1000)));
+    const auto& prepared = g.prepared_txs().at(pid.get_id());
+    BOOST_REQUIRE_EQUAL(prepared.pid, pid);
+    BOOST_REQUIRE_EQUAL(prepared.offsets.at(tp).offset, model::offset(20));
+    BOOST_REQUIRE_EQUAL(prepared.offsets.at(tp).log_offset, model::offset(12));
+
+    const auto& h = decoded.groups.at(kafka::group_id("h"));
+    BOOST_REQUIRE(!h.is_loaded());
+    BOOST_REQUIRE(h.has_data());
+    BOOST_REQUIRE_EQUAL(h.offsets().at(tp).log_offset, model::offset(11));
+}
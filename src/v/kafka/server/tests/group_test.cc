@@ -53,6 +53,7 @@ static group get() {
       conf,
       nullptr,
       nullptr,
+      nullptr,
       model::term_id(),
       fr,
       feature_table,
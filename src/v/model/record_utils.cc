@@ -10,6 +10,7 @@
 #include "model/record_utils.h"
 
 #include "hashing/crc32c.h"
+#include "likely.h"
 #include "model/record.h"
 #include "reflection/adl.h"
 #include "utils/vint.h"
@@ -175,6 +176,34 @@ model::record parse_one_record_copy_from_buffer(iobuf_const_parser& parser) {
       });
 }
 
+static void skip_record_blob(iobuf_const_parser& parser) {
+    auto [length, _] = parser.read_varlong();
+    if (length > 0) {
+        parser.skip(length);
+    }
+}
+
+void verify_record_framing(const iobuf& records, int32_t record_count) {
+    iobuf_const_parser parser(records);
+    for (int32_t i = 0; i < record_count; ++i) {
+        parse_record_meta_from_buffer(parser);
+        parser.read_varlong(); // timestamp delta
+        parser.read_varlong(); // offset delta
+        skip_record_blob(parser); // key
+        skip_record_blob(parser); // value
+        auto [header_count, _] = parser.read_varlong();
+        for (int64_t h = 0; h < header_count; ++h) {
+            skip_record_blob(parser); // header key
+            skip_record_blob(parser); // header value
+        }
+    }
+    if (unlikely(parser.bytes_left())) {
+        throw std::out_of_range(fmt::format(
+          "Record iteration stopped with {} bytes remaining",
+          parser.bytes_left()));
+    }
+}
+
 static inline void append_vint_to_iobuf(iobuf& b, int64_t v) {
     auto vb = vint::to_bytes(v);
     b.append(vb.data(), vb.size());
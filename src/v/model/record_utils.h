@@ -32,6 +32,12 @@ uint32_t internal_header_only_crc(const record_batch_header&);
 
 model::record parse_one_record_from_buffer(iobuf_parser& parser);
 model::record parse_one_record_copy_from_buffer(iobuf_const_parser& parser);
+
+/// \brief checks that `records` holds exactly `record_count` well formed
+/// records by walking their framing, without materializing keys, values or
+/// headers. Throws std::out_of_range on malformed input, like
+/// record_batch::for_each_record does.
+void verify_record_framing(const iobuf& records, int32_t record_count);
 void append_record_to_buffer(iobuf& a, const model::record& r);
 
 } // namespace model
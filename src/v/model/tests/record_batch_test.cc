@@ -78,3 +78,26 @@ SEASTAR_THREAD_TEST_CASE(set_max_timestamp) {
     BOOST_TEST(crc == batch.header().crc);
     BOOST_TEST(hdr_crc == batch.header().header_crc);
 }
+
+SEASTAR_THREAD_TEST_CASE(verify_record_framing) {
+    auto batch = model::test::make_random_batch(model::offset(0), 10, false);
+    BOOST_REQUIRE_NO_THROW(
+      model::verify_record_framing(batch.data(), batch.record_count()));
+
+    // fewer records than the header claims leaves bytes behind
+    BOOST_REQUIRE_THROW(
+      model::verify_record_framing(batch.data(), batch.record_count() - 1),
+      std::out_of_range);
+
+    // more records than present runs out of input
+    BOOST_REQUIRE_THROW(
+      model::verify_record_framing(batch.data(), batch.record_count() + 1),
+      std::out_of_range);
+
+    // truncated records fail as well
+    auto truncated = batch.data().copy();
+    truncated.trim_back(1);
+    BOOST_REQUIRE_THROW(
+      model::verify_record_framing(truncated, batch.record_count()),
+      std::out_of_range);
+}
@@ -13,6 +13,7 @@
 
 #include "bytes/iobuf.h"
 #include "bytes/iobuf_parser.h"
+#include "json/iobuf_writer.h"
 #include "json/reader.h"
 #include "json/stream.h"
 #include "json/stringbuffer.h"
@@ -65,7 +66,8 @@ public:
     explicit rjson_serialize_impl(serialization_format fmt)
       : _fmt(fmt) {}
 
-    bool operator()(::json::Writer<::json::StringBuffer>& w, iobuf buf) {
+    template<typename Writer>
+    bool operator()(Writer& w, iobuf buf) {
         switch (_fmt) {
         case serialization_format::none:
             [[fallthrough]];
@@ -80,15 +82,24 @@ public:
         }
     }
 
-    bool encode_base64(::json::Writer<::json::StringBuffer>& w, iobuf buf) {
+    template<typename Buffer>
+    bool encode_base64(::json::Writer<Buffer>& w, iobuf buf) {
         if (buf.empty()) {
             return w.Null();
         }
-        // TODO Ben: Implement custom OutputStream to prevent this linearization
         return w.String(iobuf_to_base64(buf));
     };
 
-    bool encode_json(::json::Writer<::json::StringBuffer>& w, iobuf buf) {
+    template<typename Buffer>
+    bool encode_base64(::json::iobuf_writer<Buffer>& w, iobuf buf) {
+        if (buf.empty()) {
+            return w.Null();
+        }
+        return w.RawString(iobuf_to_base64_chunked(buf));
+    };
+
+    template<typename Writer>
+    bool encode_json(Writer& w, iobuf buf) {
         if (buf.empty()) {
             return w.Null();
         }
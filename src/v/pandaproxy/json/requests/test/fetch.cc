@@ -9,6 +9,9 @@
 
 #include "pandaproxy/json/requests/fetch.h"
 
+#include "bytes/iobuf_parser.h"
+#include "json/chunked_buffer.h"
+#include "json/iobuf_writer.h"
 #include "json/stringbuffer.h"
 #include "json/writer.h"
 #include "kafka/client/test/utils.h"
@@ -97,3 +100,22 @@ SEASTAR_THREAD_TEST_CASE(test_produce_fetch_one) {
 
     BOOST_REQUIRE_EQUAL(str_buf.GetString(), expected);
 }
+
+SEASTAR_THREAD_TEST_CASE(test_produce_fetch_chunked) {
+    std::vector<model::topic_partition> tps = {
+      {model::topic{"topic1"}, model::partition_id{1}},
+      {model::topic{"topic2"}, model::partition_id{2}},
+    };
+    auto res = make_fetch_response(tps, model::offset{42}, 1);
+    auto fmt = ppj::serialization_format::binary_v2;
+
+    ::json::chunked_buffer buf;
+    ::json::iobuf_writer<::json::chunked_buffer> w(buf);
+    ppj::rjson_serialize_fmt(fmt)(w, std::move(res));
+
+    auto expected
+      = R"([{"topic":"topic1","key":"KgAAAAAAAAA=","value":null,"partition":1,"offset":42},{"topic":"topic2","key":"KgAAAAAAAAA=","value":null,"partition":2,"offset":42}])";
+
+    iobuf_parser p(std::move(buf).as_iobuf());
+    BOOST_REQUIRE_EQUAL(p.read_string(p.bytes_left()), expected);
+}
@@ -11,6 +11,8 @@
 
 #pragma once
 
+#include "bytes/iobuf.h"
+#include "bytes/iostream.h"
 #include "kafka/client/exceptions.h"
 #include "kafka/protocol/exceptions.h"
 #include "pandaproxy/error.h"
@@ -22,7 +24,9 @@
 #include "pandaproxy/schema_registry/exceptions.h"
 #include "seastarx.h"
 
+#include <seastar/core/do_with.hh>
 #include <seastar/core/gate.hh>
+#include <seastar/core/iostream.hh>
 #include <seastar/core/sstring.hh>
 #include <seastar/http/exception.hh>
 #include <seastar/http/reply.hh>
@@ -55,6 +59,23 @@ error_code_to_status(std::error_condition ec) {
     return static_cast<ss::http::reply::status_type>(value);
 }
 
+/// \brief Sets \p body as the reply body, sent fragment by fragment with
+/// chunked transfer encoding rather than linearized into one string.
+inline void
+write_body(ss::http::reply& rep, const ss::sstring& type, iobuf body) {
+    rep.write_body(
+      type,
+      [body = std::move(body)](ss::output_stream<char>&& os) mutable {
+          return ss::do_with(
+            std::move(os),
+            std::move(body),
+            [](ss::output_stream<char>& os, iobuf& body) {
+                return write_iobuf_to_output_stream(std::move(body), os)
+                  .finally([&os] { return os.close(); });
+            });
+      });
+}
+
 inline ss::http::reply& set_reply_unavailable(ss::http::reply& rep) {
     return rep.set_status(ss::http::reply::status_type::service_unavailable)
       .add_header("Retry-After", "0");
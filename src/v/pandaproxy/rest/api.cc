@@ -28,12 +28,16 @@ api::api(
   size_t max_memory,
   kafka::client::configuration& client_cfg,
   configuration& cfg,
-  cluster::controller* c) noexcept
+  cluster::controller* c,
+  bool local_client,
+  ss::sharded<kafka::quota_manager>* quota_mgr) noexcept
   : _sg{sg}
   , _max_memory{max_memory}
   , _client_cfg{client_cfg}
   , _cfg{cfg}
-  , _controller(c) {}
+  , _controller(c)
+  , _local_client(local_client)
+  , _quota_mgr(quota_mgr) {}
 
 api::~api() noexcept = default;
 
@@ -56,7 +60,9 @@ ss::future<> api::start() {
       _max_memory,
       std::ref(_client),
       std::ref(_client_cache),
-      _controller);
+      _controller,
+      _local_client,
+      _quota_mgr);
 
     co_await _proxy.invoke_on_all(&proxy::start);
 }
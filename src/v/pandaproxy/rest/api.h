@@ -13,6 +13,7 @@
 
 #include "cluster/controller_api.h"
 #include "kafka/client/fwd.h"
+#include "kafka/server/fwd.h"
 #include "model/metadata.h"
 #include "pandaproxy/fwd.h"
 #include "pandaproxy/rest/fwd.h"
@@ -30,12 +31,17 @@ namespace pandaproxy::rest {
 
 class api {
 public:
+    /// \p local_client is set when the kafka client talks to this very node,
+    /// which lets produce and fetch for the partitions it leads skip the
+    /// client. They are then accounted against the broker's \p quota_mgr.
     api(
       ss::smp_service_group sg,
       size_t max_memory,
       kafka::client::configuration& client_cfg,
       configuration& cfg,
-      cluster::controller*) noexcept;
+      cluster::controller*,
+      bool local_client = false,
+      ss::sharded<kafka::quota_manager>* quota_mgr = nullptr) noexcept;
     ~api() noexcept;
 
     ss::future<> start();
@@ -51,6 +57,8 @@ private:
     kafka::client::configuration& _client_cfg;
     configuration& _cfg;
     cluster::controller* _controller;
+    bool _local_client;
+    ss::sharded<kafka::quota_manager>* _quota_mgr;
 
     ss::sharded<kafka::client::client> _client;
     ss::sharded<kafka_client_cache> _client_cache;
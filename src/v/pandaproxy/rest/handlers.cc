@@ -12,6 +12,8 @@
 #include "config/rest_authn_endpoint.h"
 #include "hashing/jump_consistent_hash.h"
 #include "hashing/xx.h"
+#include "json/chunked_buffer.h"
+#include "json/iobuf_writer.h"
 #include "kafka/client/exceptions.h"
 #include "kafka/protocol/errors.h"
 #include "kafka/protocol/fetch.h"
@@ -155,21 +157,34 @@ get_topics_records(server::request_t rq, server::reply_t rp) {
       max_bytes);
 
     co_return co_await rq
-      .dispatch([offset, timeout, max_bytes, res_fmt, tp{std::move(tp)}](
+      .dispatch([offset,
+                 timeout,
+                 max_bytes,
+                 res_fmt,
+                 tp{std::move(tp)},
+                 &proxies = rq.service().container(),
+                 principal = rq.service().client_principal(
+                   rq.user, rq.authn_method)](
                   kafka::client::client& client) mutable {
-          return client
-            .fetch_partition(std::move(tp), offset, max_bytes, timeout)
+          return proxies.local()
+            .local_leaders()
+            .fetch_partition(
+              client,
+              std::move(tp),
+              offset,
+              max_bytes,
+              timeout,
+              std::move(principal))
             .then([res_fmt](kafka::fetch_response res) {
-                ::json::StringBuffer str_buf;
-                ::json::Writer<::json::StringBuffer> w(str_buf);
+                ::json::chunked_buffer buf;
+                ::json::iobuf_writer<::json::chunked_buffer> w(buf);
 
                 ppj::rjson_serialize_fmt(res_fmt)(w, std::move(res));
-                // TODO Ben: Prevent this linearization
-                return ss::make_ready_future<ss::sstring>(str_buf.GetString());
+                return std::move(buf).as_iobuf();
             });
       })
-      .then([res_fmt, rp = std::move(rp)](ss::sstring json_rslt) mutable {
-          rp.rep->write_body("json", json_rslt);
+      .then([res_fmt, rp = std::move(rp)](iobuf json_rslt) mutable {
+          write_body(*rp.rep, "json", std::move(json_rslt));
           rp.mime_type = res_fmt;
           return std::move(rp);
       });
@@ -194,10 +209,16 @@ post_topics_name(server::request_t rq, server::reply_t rp) {
        topic,
        req_fmt,
        res_fmt,
-       rp{std::move(rp)}](kafka::client::client& client) mutable {
+       rp{std::move(rp)},
+       &proxies = rq.service().container(),
+       principal = rq.service().client_principal(rq.user, rq.authn_method)](
+        kafka::client::client& client) mutable {
           auto records = ppj::rjson_parse(
             data, ppj::produce_request_handler(req_fmt));
-          return client.produce_records(topic, std::move(records))
+          return proxies.local()
+            .local_leaders()
+            .produce_records(
+              client, topic, std::move(records), std::move(principal))
             .then([rp{std::move(rp)},
                    res_fmt](kafka::produce_response res) mutable {
                 auto json_rslt = ppj::rjson_serialize(res.data.responses[0]);
@@ -410,14 +431,12 @@ consumer_fetch(server::request_t rq, server::reply_t rp) {
 
           return client.consumer_fetch(group_id, name, timeout, max_bytes)
             .then([res_fmt, rp{std::move(rp)}](auto res) mutable {
-                ::json::StringBuffer str_buf;
-                ::json::Writer<::json::StringBuffer> w(str_buf);
+                ::json::chunked_buffer buf;
+                ::json::iobuf_writer<::json::chunked_buffer> w(buf);
 
                 ppj::rjson_serialize_fmt(res_fmt)(w, std::move(res));
 
-                // TODO Ben: Prevent this linearization
-                ss::sstring json_rslt = str_buf.GetString();
-                rp.rep->write_body("json", json_rslt);
+                write_body(*rp.rep, "json", std::move(buf).as_iobuf());
                 rp.mime_type = res_fmt;
                 return std::move(rp);
             });
@@ -0,0 +1,378 @@
+// Copyright 2023 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "pandaproxy/rest/local_partitions.h"
+
+#include "cluster/controller.h"
+#include "cluster/partition_leaders_table.h"
+#include "cluster/shard_table.h"
+#include "cluster/topic_table.h"
+#include "config/configuration.h"
+#include "config/node_config.h"
+#include "kafka/client/client.h"
+#include "kafka/server/handlers/fetch.h"
+#include "kafka/server/handlers/produce.h"
+#include "kafka/server/quota_manager.h"
+#include "model/namespace.h"
+#include "model/record_batch_reader.h"
+#include "pandaproxy/logger.h"
+#include "pandaproxy/schema_registry/schema_id_validation.h"
+#include "security/authorizer.h"
+#include "storage/record_batch_builder.h"
+
+#include <seastar/core/coroutine.hh>
+#include <seastar/core/sleep.hh>
+
+#include <absl/container/flat_hash_map.h>
+
+#include <algorithm>
+#include <iterator>
+
+namespace pandaproxy::rest {
+
+namespace {
+
+// The kafka client produces with acks=all and no request timeout.
+constexpr int16_t produce_acks = -1;
+constexpr std::chrono::milliseconds produce_timeout{0};
+
+// The client id the broker accounts the client's requests to
+std::optional<std::string_view> client_id(kafka::client::client& client) {
+    const auto& id = client.config().client_identifier();
+    if (!id) {
+        return std::nullopt;
+    }
+    return *id;
+}
+
+model::record_batch
+make_batch(const std::vector<kafka::client::record_essence>& records) {
+    storage::record_batch_builder builder(
+      model::record_batch_type::raft_data, model::offset(0));
+    for (const auto& r : records) {
+        std::vector<model::record_header> headers;
+        headers.reserve(r.headers.size());
+        for (const auto& h : r.headers) {
+            headers.push_back(h.copy());
+        }
+        builder.add_raw_kw(
+          r.key ? r.key->copy() : iobuf{},
+          r.value ? std::make_optional(r.value->copy()) : std::nullopt,
+          std::move(headers));
+    }
+    return std::move(builder).build();
+}
+
+} // namespace
+
+local_partitions::local_partitions(
+  cluster::controller* controller,
+  ss::sharded<kafka::quota_manager>* quota_mgr,
+  ss::smp_service_group smp_sg,
+  bool enabled)
+  : _controller(controller)
+  , _quota_mgr(quota_mgr)
+  , _smp_sg(smp_sg)
+  , _enabled(enabled && controller != nullptr && quota_mgr != nullptr) {}
+
+bool local_partitions::may_serve(
+  const security::authorizer& authorizer,
+  const model::topic& topic,
+  security::acl_operation op,
+  const security::acl_principal& principal) {
+    const auto& cfg = config::shard_local_cfg();
+    // Schema id validation lives in the kafka produce handler, leave it there
+    if (
+      cfg.enable_schema_id_validation()
+      != schema_registry::schema_id_validation_mode::none) {
+        return false;
+    }
+    // Node wide throughput limits are enforced per kafka connection
+    if (
+      cfg.kafka_throughput_limit_node_in_bps()
+      || cfg.kafka_throughput_limit_node_out_bps()) {
+        return false;
+    }
+    if (op == security::acl_operation::write) {
+        const auto& noproduce = cfg.kafka_noproduce_topics();
+        if (
+          std::find(noproduce.begin(), noproduce.end(), topic)
+          != noproduce.end()) {
+            return false;
+        }
+    }
+    if (!cfg.kafka_enable_authorization().value_or(cfg.enable_sasl())) {
+        return true;
+    }
+    // The client connection's address is not known here. A decision made for
+    // the wildcard host holds for every host unless an ACL for a specific
+    // host denies the operation; anything else is left for the broker.
+    return authorizer.authorized(
+             topic, op, principal, security::acl_host::wildcard_host())
+           && !authorizer.host_specific_deny(topic, op, principal);
+}
+
+bool local_partitions::may_serve(
+  const model::topic& topic,
+  security::acl_operation op,
+  const security::acl_principal& principal) const {
+    return _enabled
+           && may_serve(
+             _controller->get_authorizer().local(), topic, op, principal);
+}
+
+std::optional<ss::shard_id>
+local_partitions::leader_shard(const model::ntp& ntp) const {
+    auto leader = _controller->get_partition_leaders().local().get_leader(ntp);
+    if (leader != config::node().node_id()) {
+        return std::nullopt;
+    }
+    return _controller->get_shard_table().local().shard_for(ntp);
+}
+
+ss::future<> local_partitions::throttle_produce(
+  kafka::client::client& client, size_t bytes) {
+    auto delay = _quota_mgr->local().record_produce_tp_and_throttle(
+      client_id(client), bytes);
+    if (delay.enforce) {
+        co_await ss::sleep(delay.enforce_duration());
+    }
+}
+
+ss::future<> local_partitions::throttle_fetch(kafka::client::client& client) {
+    auto delay = _quota_mgr->local().throttle_fetch_tp(client_id(client));
+    if (delay.enforce) {
+        co_await ss::sleep(delay.enforce_duration());
+    }
+}
+
+void local_partitions::record_fetch(
+  kafka::client::client& client, size_t bytes) {
+    _quota_mgr->local().record_fetch_tp(client_id(client), bytes);
+}
+
+ss::future<kafka::produce_response> local_partitions::produce_records(
+  kafka::client::client& client,
+  model::topic topic,
+  std::vector<kafka::client::record_essence> records,
+  security::acl_principal principal) {
+    if (!may_serve(topic, security::acl_operation::write, principal)) {
+        co_return co_await client.produce_records(
+          std::move(topic), std::move(records));
+    }
+
+    struct local_batch {
+        ss::shard_id shard;
+        // kept to forward them if the partition moved in the meantime
+        std::vector<kafka::client::record_essence> records;
+    };
+    absl::flat_hash_map<model::partition_id, std::optional<ss::shard_id>>
+      shards;
+    absl::flat_hash_map<model::partition_id, local_batch> local;
+    std::vector<kafka::client::record_essence> forwarded;
+
+    // Assign records to partitions as the client would, and split off the
+    // ones for partitions led by this broker
+    for (auto& record : records) {
+        if (!record.partition_id) {
+            record.partition_id = co_await client.partition_for(topic, record);
+        }
+        auto p_id = *record.partition_id;
+        auto [s_it, inserted] = shards.try_emplace(p_id);
+        if (inserted) {
+            s_it->second = leader_shard(
+              model::ntp(model::kafka_namespace, topic, p_id));
+        }
+        if (!s_it->second) {
+            forwarded.push_back(std::move(record));
+            continue;
+        }
+        auto it = local.find(p_id);
+        if (it == local.end()) {
+            it = local.emplace(p_id, local_batch{.shard = *s_it->second})
+                   .first;
+        }
+        it->second.records.push_back(std::move(record));
+    }
+
+    auto forwarded_f = forwarded.empty()
+                         ? ss::make_ready_future<kafka::produce_response>()
+                         : client.produce_records(topic, std::move(forwarded));
+
+    std::vector<ss::future<kafka::produce_response::partition>> produced;
+    if (!local.empty()) {
+        auto topic_cfg = _controller->get_topics_state().local().get_topic_cfg(
+          model::topic_namespace_view(model::kafka_namespace, topic));
+        const auto& cfg = config::shard_local_cfg();
+        auto batch_max_bytes = cfg.kafka_batch_max_bytes();
+        auto timestamp_type = cfg.log_message_timestamp_type();
+        if (topic_cfg) {
+            batch_max_bytes = topic_cfg->properties.batch_max_bytes.value_or(
+              batch_max_bytes);
+            timestamp_type = topic_cfg->properties.timestamp_type.value_or(
+              timestamp_type);
+        }
+        std::vector<std::pair<model::partition_id, model::record_batch>>
+          batches;
+        batches.reserve(local.size());
+        size_t local_bytes = 0;
+        for (auto& [p_id, b] : local) {
+            auto batch = make_batch(b.records);
+            if (timestamp_type == model::timestamp_type::append_time) {
+                batch.set_max_timestamp(
+                  model::timestamp_type::append_time, model::timestamp::now());
+            }
+            local_bytes += batch.size_bytes();
+            batches.emplace_back(p_id, std::move(batch));
+        }
+        // Client quotas apply as if the batches went through the broker
+        co_await throttle_produce(client, local_bytes);
+        produced.reserve(batches.size());
+        for (auto& [p_id, batch] : batches) {
+            produced.push_back(produce_local(
+              local.at(p_id).shard,
+              model::ntp(model::kafka_namespace, topic, p_id),
+              std::move(batch),
+              batch_max_bytes));
+        }
+    }
+
+    auto partitions = co_await ss::when_all_succeed(
+      produced.begin(), produced.end());
+
+    // Leadership moved since the leaders table was consulted, the client
+    // refreshes its metadata and produces to the new leaders
+    std::vector<kafka::client::record_essence> moved;
+    std::erase_if(partitions, [&](const kafka::produce_response::partition& p) {
+        if (
+          p.error_code != kafka::error_code::not_leader_for_partition
+          && p.error_code != kafka::error_code::unknown_topic_or_partition) {
+            return false;
+        }
+        vlog(
+          plog.debug,
+          "produce_records: {}/{} moved, forwarding",
+          topic,
+          p.partition_index);
+        auto& records = local.at(p.partition_index).records;
+        std::move(records.begin(), records.end(), std::back_inserter(moved));
+        return true;
+    });
+    auto moved_f = moved.empty()
+                     ? ss::make_ready_future<kafka::produce_response>()
+                     : client.produce_records(topic, std::move(moved));
+
+    auto res = co_await std::move(forwarded_f);
+    auto moved_res = co_await std::move(moved_f);
+    if (!moved_res.data.responses.empty()) {
+        auto& moved_partitions = moved_res.data.responses.front().partitions;
+        std::move(
+          moved_partitions.begin(),
+          moved_partitions.end(),
+          std::back_inserter(partitions));
+    }
+    if (res.data.responses.empty()) {
+        res.data.responses.push_back({.name = std::move(topic)});
+    }
+    auto& responses = res.data.responses.front().partitions;
+    std::move(
+      partitions.begin(), partitions.end(), std::back_inserter(responses));
+    co_return res;
+}
+
+ss::future<kafka::produce_response::partition> local_partitions::produce_local(
+  ss::shard_id shard,
+  model::ntp ntp,
+  model::record_batch batch,
+  uint32_t batch_max_bytes) {
+    auto bid = model::batch_identity::from(batch.header());
+    auto batch_size = batch.size_bytes();
+    return ss::smp::submit_to(
+      shard,
+      ss::smp_submit_to_options(_smp_sg),
+      [&pm = _controller->get_partition_manager(),
+       ntp = std::move(ntp),
+       bid,
+       batch_size,
+       batch_max_bytes,
+       batch = std::move(batch)]() mutable {
+          return kafka::produce_to_local_leader(
+            pm.local(),
+            ntp,
+            bid,
+            model::make_foreign_memory_record_batch_reader(std::move(batch)),
+            batch_size,
+            batch_max_bytes,
+            produce_acks,
+            produce_timeout);
+      });
+}
+
+ss::future<kafka::fetch_response> local_partitions::fetch_partition(
+  kafka::client::client& client,
+  model::topic_partition tp,
+  model::offset offset,
+  int32_t max_bytes,
+  std::chrono::milliseconds timeout,
+  security::acl_principal principal) {
+    std::optional<ss::shard_id> shard;
+    model::ktp ktp(tp.topic, tp.partition);
+    if (may_serve(tp.topic, security::acl_operation::read, principal)) {
+        shard = leader_shard(ktp.to_ntp());
+    }
+    if (!shard) {
+        co_return co_await client.fetch_partition(
+          std::move(tp), offset, max_bytes, timeout);
+    }
+
+    co_await throttle_fetch(client);
+    auto deadline = model::timeout_clock::now() + timeout;
+    kafka::fetch_config config{
+      .start_offset = offset,
+      .max_offset = model::offset::max(),
+      .max_bytes = static_cast<size_t>(std::max(max_bytes, 0)),
+      .timeout = deadline,
+      .isolation_level = model::isolation_level::read_uncommitted,
+    };
+    auto res = co_await ss::smp::submit_to(
+      *shard,
+      ss::smp_submit_to_options(_smp_sg),
+      [&pm = _controller->get_partition_manager(), ktp, config, deadline]() {
+          return kafka::read_from_local_leader(
+            pm.local(), ktp, config, deadline);
+      });
+
+    // Leadership moved since the leaders table was consulted
+    if (
+      res.error == kafka::error_code::not_leader_for_partition
+      || res.error == kafka::error_code::unknown_topic_or_partition) {
+        vlog(plog.debug, "fetch_partition: {} moved, forwarding", tp);
+        co_return co_await client.fetch_partition(
+          std::move(tp), offset, max_bytes, timeout);
+    }
+
+    kafka::fetch_response::partition_response pr{
+      .partition_index = tp.partition,
+      .error_code = res.error,
+      .high_watermark = res.high_watermark,
+      .last_stable_offset = res.last_stable_offset,
+      .log_start_offset = res.start_offset,
+    };
+    if (res.has_data()) {
+        record_fetch(client, res.get_data().size_bytes());
+        pr.records = kafka::batch_reader(std::move(res).release_data());
+    }
+    kafka::fetch_response::partition partition{.name = std::move(tp.topic)};
+    partition.partitions.push_back(std::move(pr));
+    kafka::fetch_response response;
+    response.data.topics.push_back(std::move(partition));
+    co_return response;
+}
+
+} // namespace pandaproxy::rest
@@ -0,0 +1,99 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "cluster/fwd.h"
+#include "kafka/client/fwd.h"
+#include "kafka/client/types.h"
+#include "kafka/protocol/fetch.h"
+#include "kafka/protocol/produce.h"
+#include "kafka/server/fwd.h"
+#include "model/fundamental.h"
+#include "model/record.h"
+#include "seastarx.h"
+#include "security/acl.h"
+#include "security/fwd.h"
+
+#include <seastar/core/future.hh>
+#include <seastar/core/sharded.hh>
+#include <seastar/core/smp.hh>
+
+#include <chrono>
+#include <optional>
+#include <vector>
+
+namespace pandaproxy::rest {
+
+/// \brief Produce and fetch for partitions led by this broker.
+///
+/// When the proxy runs inside the broker its kafka client talks to the very
+/// same broker over loopback, so every record is serialized, parsed and
+/// authorized twice. For partitions this broker leads the work is instead
+/// handed to the partition's kafka layer on its home shard, and accounted
+/// against the client quotas of the broker. Everything else, including
+/// partitions led elsewhere and requests the broker might decide about
+/// differently, goes through the client.
+class local_partitions {
+public:
+    /// \brief The in process path is only taken when \p enabled, which is
+    /// only valid if the kafka client talks to this very cluster.
+    local_partitions(
+      cluster::controller*,
+      ss::sharded<kafka::quota_manager>*,
+      ss::smp_service_group,
+      bool enabled);
+
+    /// \brief Whether a request may skip the broker, i.e. whether the broker
+    /// would decide about it the same way whatever the address of the client
+    /// connection: the topic accepts produce requests, no host specific ACL
+    /// denies the operation and no node wide throughput limit applies.
+    static bool may_serve(
+      const security::authorizer&,
+      const model::topic&,
+      security::acl_operation,
+      const security::acl_principal&);
+
+    ss::future<kafka::produce_response> produce_records(
+      kafka::client::client& client,
+      model::topic topic,
+      std::vector<kafka::client::record_essence> records,
+      security::acl_principal principal);
+
+    ss::future<kafka::fetch_response> fetch_partition(
+      kafka::client::client& client,
+      model::topic_partition tp,
+      model::offset offset,
+      int32_t max_bytes,
+      std::chrono::milliseconds timeout,
+      security::acl_principal principal);
+
+private:
+    bool may_serve(
+      const model::topic&,
+      security::acl_operation,
+      const security::acl_principal&) const;
+    std::optional<ss::shard_id> leader_shard(const model::ntp&) const;
+
+    ss::future<> throttle_produce(kafka::client::client&, size_t bytes);
+    ss::future<> throttle_fetch(kafka::client::client&);
+    void record_fetch(kafka::client::client&, size_t bytes);
+
+    ss::future<kafka::produce_response::partition> produce_local(
+      ss::shard_id, model::ntp, model::record_batch, uint32_t batch_max_bytes);
+
+    cluster::controller* _controller;
+    ss::sharded<kafka::quota_manager>* _quota_mgr;
+    ss::smp_service_group _smp_sg;
+    bool _enabled;
+};
+
+} // namespace pandaproxy::rest
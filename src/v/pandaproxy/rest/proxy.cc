@@ -108,7 +108,9 @@ proxy::proxy(
   size_t max_memory,
   ss::sharded<kafka::client::client>& client,
   ss::sharded<kafka_client_cache>& client_cache,
-  cluster::controller* controller)
+  cluster::controller* controller,
+  bool local_client,
+  ss::sharded<kafka::quota_manager>* quota_mgr)
   : _config(config)
   , _mem_sem(max_memory, "pproxy/mem")
   , _client(client)
@@ -125,7 +127,8 @@ proxy::proxy(
       _ctx,
       json::serialization_format::application_json)
   , _ensure_started{[this]() { return do_start(); }}
-  , _controller(controller) {}
+  , _controller(controller)
+  , _local_partitions(controller, quota_mgr, smp_sg, local_client) {}
 
 ss::future<> proxy::start() {
     _server.routes(get_proxy_routes(_gate, _ensure_started));
@@ -146,6 +149,19 @@ kafka::client::configuration& proxy::client_config() {
     return _client.local().config();
 }
 
+security::acl_principal proxy::client_principal(
+  const credential_t& user, config::rest_authn_method authn_method) const {
+    if (authn_method == config::rest_authn_method::http_basic) {
+        return {security::principal_type::user, user.name};
+    }
+    if (_has_ephemeral_credentials) {
+        return principal;
+    }
+    return {
+      security::principal_type::user,
+      _client.local().config().scram_username()};
+}
+
 ss::future<> proxy::do_start() {
     if (_is_started) {
         co_return;
@@ -14,7 +14,9 @@
 #include "cluster/fwd.h"
 #include "pandaproxy/fwd.h"
 #include "pandaproxy/rest/configuration.h"
+#include "pandaproxy/rest/local_partitions.h"
 #include "pandaproxy/server.h"
+#include "pandaproxy/types.h"
 #include "pandaproxy/util.h"
 #include "seastarx.h"
 #include "utils/request_auth.h"
@@ -37,7 +39,9 @@ public:
       size_t max_memory,
       ss::sharded<kafka::client::client>& client,
       ss::sharded<kafka_client_cache>& client_cache,
-      cluster::controller* controller);
+      cluster::controller* controller,
+      bool local_client,
+      ss::sharded<kafka::quota_manager>* quota_mgr);
 
     ss::future<> start();
     ss::future<> stop();
@@ -46,8 +50,13 @@ public:
     kafka::client::configuration& client_config();
     ss::sharded<kafka::client::client>& client() { return _client; }
     ss::sharded<kafka_client_cache>& client_cache() { return _client_cache; }
+    local_partitions& local_leaders() { return _local_partitions; }
     ss::future<> mitigate_error(std::exception_ptr);
 
+    /// \brief The principal the kafka client acts as for a request.
+    security::acl_principal
+    client_principal(const credential_t& user, config::rest_authn_method) const;
+
 private:
     ss::future<> do_start();
     ss::future<> configure();
@@ -63,6 +72,7 @@ private:
     server _server;
     one_shot _ensure_started;
     cluster::controller* _controller;
+    local_partitions _local_partitions;
     bool _has_ephemeral_credentials{false};
     bool _is_started{false};
 };
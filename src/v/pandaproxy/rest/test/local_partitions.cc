@@ -0,0 +1,111 @@
+// Copyright 2023 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "config/property.h"
+#include "model/fundamental.h"
+#include "pandaproxy/rest/local_partitions.h"
+#include "security/acl.h"
+#include "security/authorizer.h"
+#include "test_utils/scoped_config.h"
+#include "units.h"
+
+#include <seastar/testing/thread_test_case.hh>
+
+#include <boost/test/tools/old/interface.hpp>
+
+using pandaproxy::rest::local_partitions;
+
+namespace {
+
+security::authorizer make_authorizer() {
+    return security::authorizer([]() {
+        return config::mock_binding<std::vector<ss::sstring>>(
+          std::vector<ss::sstring>{});
+    });
+}
+
+void add_acl(
+  security::authorizer& auth,
+  const model::topic& topic,
+  const security::acl_principal& principal,
+  security::acl_host host,
+  security::acl_permission permission) {
+    security::resource_pattern resource(
+      security::resource_type::topic,
+      topic(),
+      security::pattern_type::literal);
+    security::acl_entry entry(
+      principal, std::move(host), security::acl_operation::write, permission);
+    auth.add_bindings({security::acl_binding(resource, entry)});
+}
+
+const security::acl_principal alice{security::principal_type::user, "alice"};
+
+} // namespace
+
+SEASTAR_THREAD_TEST_CASE(local_partitions_skip_noproduce_topics) {
+    scoped_config cfg;
+    auto auth = make_authorizer();
+    model::topic noproduce("noproduce");
+    model::topic other("other");
+
+    BOOST_REQUIRE(local_partitions::may_serve(
+      auth, noproduce, security::acl_operation::write, alice));
+
+    cfg.get("kafka_noproduce_topics")
+      .set_value(std::vector<ss::sstring>{noproduce()});
+
+    BOOST_REQUIRE(!local_partitions::may_serve(
+      auth, noproduce, security::acl_operation::write, alice));
+    BOOST_REQUIRE(local_partitions::may_serve(
+      auth, noproduce, security::acl_operation::read, alice));
+    BOOST_REQUIRE(local_partitions::may_serve(
+      auth, other, security::acl_operation::write, alice));
+}
+
+SEASTAR_THREAD_TEST_CASE(local_partitions_skip_host_specific_deny) {
+    scoped_config cfg;
+    cfg.get("kafka_enable_authorization").set_value(std::optional<bool>(true));
+    auto auth = make_authorizer();
+    model::topic topic("topic");
+
+    BOOST_REQUIRE(!local_partitions::may_serve(
+      auth, topic, security::acl_operation::write, alice));
+
+    add_acl(
+      auth,
+      topic,
+      alice,
+      security::acl_host::wildcard_host(),
+      security::acl_permission::allow);
+    BOOST_REQUIRE(local_partitions::may_serve(
+      auth, topic, security::acl_operation::write, alice));
+
+    // the broker would deny a connection from that host, and the address of
+    // the proxy's connection isn't known to the in process path
+    add_acl(
+      auth,
+      topic,
+      alice,
+      security::acl_host("10.0.0.1"),
+      security::acl_permission::deny);
+    BOOST_REQUIRE(!local_partitions::may_serve(
+      auth, topic, security::acl_operation::write, alice));
+}
+
+SEASTAR_THREAD_TEST_CASE(local_partitions_skip_node_throughput_limits) {
+    scoped_config cfg;
+    auto auth = make_authorizer();
+    model::topic topic("topic");
+
+    cfg.get("kafka_throughput_limit_node_in_bps")
+      .set_value(std::optional<int64_t>(1_MiB));
+    BOOST_REQUIRE(!local_partitions::may_serve(
+      auth, topic, security::acl_operation::write, alice));
+}
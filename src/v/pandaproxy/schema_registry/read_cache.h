@@ -0,0 +1,133 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "pandaproxy/schema_registry/types.h"
+
+#include <absl/container/flat_hash_map.h>
+#include <absl/hash/hash.h>
+
+#include <cstdint>
+#include <optional>
+
+namespace pandaproxy::schema_registry {
+
+///\brief A shard local cache of schema definitions and subject versions.
+///
+/// The store is sharded by subject and schema id, so a lookup from any other
+/// shard is a cross core hop, and hot subjects load their home shard. Lookups
+/// are served from this cache on the caller's shard instead.
+///
+/// The cache is versioned by the store's write generation. Every write applied
+/// to the store advances the generation on every shard and drops the cached
+/// entries. A lookup only populates the cache if no write completed while it
+/// was in flight, so a hit never returns data older than the last write.
+///
+/// The cache starts disabled and holds nothing until enabled, so that writes
+/// need not invalidate it while the store is loaded.
+class read_cache {
+public:
+    using generation = uint64_t;
+
+    struct version_entry {
+        schema_version version;
+        schema_id id;
+        is_deleted deleted;
+    };
+
+    explicit read_cache(size_t capacity)
+      : _capacity(capacity) {}
+
+    ///\brief The generation to pass to put_* for a lookup starting now.
+    generation current() const { return _generation; }
+
+    bool enabled() const { return _enabled; }
+
+    void enable() { _enabled = true; }
+
+    ///\brief Drop every entry, a write has been applied to the store.
+    void invalidate() {
+        ++_generation;
+        _schemas.clear();
+        _versions.clear();
+    }
+
+    std::optional<canonical_schema_definition>
+    get_schema_definition(schema_id id) const {
+        auto it = _schemas.find(id);
+        if (it == _schemas.end()) {
+            return std::nullopt;
+        }
+        return it->second;
+    }
+
+    void put_schema_definition(
+      generation gen, schema_id id, const canonical_schema_definition& def) {
+        if (
+          _enabled && gen == _generation && _schemas.size() < _capacity) {
+            _schemas.try_emplace(id, def);
+        }
+    }
+
+    std::optional<version_entry> get_subject_version_id(
+      const subject& sub,
+      std::optional<schema_version> version,
+      include_deleted inc_del) const {
+        auto it = _versions.find(version_key{sub, version, bool(inc_del)});
+        if (it == _versions.end()) {
+            return std::nullopt;
+        }
+        return it->second;
+    }
+
+    void put_subject_version_id(
+      generation gen,
+      const subject& sub,
+      std::optional<schema_version> version,
+      include_deleted inc_del,
+      version_entry entry) {
+        if (
+          _enabled && gen == _generation && _versions.size() < _capacity) {
+            _versions.try_emplace(
+              version_key{sub, version, bool(inc_del)}, entry);
+        }
+    }
+
+private:
+    struct version_key {
+        subject sub;
+        std::optional<schema_version> version;
+        bool inc_del;
+
+        bool operator==(const version_key&) const = default;
+
+        template<typename H>
+        friend H AbslHashValue(H h, const version_key& k) {
+            return H::combine(
+              std::move(h),
+              k.sub(),
+              k.version.has_value(),
+              k.version.value_or(invalid_schema_version)(),
+              k.inc_del);
+        }
+    };
+
+    // Once full, entries are only added again after the next write. The hot
+    // entries are looked up first after a write, so they are the ones kept.
+    size_t _capacity;
+    bool _enabled{false};
+    generation _generation{0};
+    absl::flat_hash_map<schema_id, canonical_schema_definition> _schemas;
+    absl::flat_hash_map<version_key, version_entry> _versions;
+};
+
+} // namespace pandaproxy::schema_registry
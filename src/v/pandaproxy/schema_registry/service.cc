@@ -194,6 +194,7 @@ ss::future<> service::do_start() {
         s._is_started = true;
         return s.fetch_internal_topic();
     });
+    co_await _store.enable_read_cache();
 }
 
 ss::future<> create_acls(cluster::security_frontend& security_fe) {
@@ -11,6 +11,7 @@
 
 #include "pandaproxy/schema_registry/sharded_store.h"
 
+#include "config/configuration.h"
 #include "hashing/jump_consistent_hash.h"
 #include "hashing/xx.h"
 #include "kafka/protocol/errors.h"
@@ -26,10 +27,12 @@
 
 #include <seastar/core/coroutine.hh>
 #include <seastar/core/future.hh>
+#include <seastar/core/loop.hh>
 #include <seastar/core/smp.hh>
 #include <seastar/coroutine/exception.hh>
 
 #include <absl/algorithm/container.h>
+#include <boost/range/irange.hpp>
 #include <fmt/core.h>
 
 #include <functional>
@@ -59,6 +62,12 @@ bool check_compatible(const valid_schema& reader, const valid_schema& writer) {
     });
 }
 
+// Entries per shard and per kind of lookup
+constexpr size_t read_cache_capacity = 1024;
+
+// Versions of a subject parsed at once by a compatibility check
+constexpr size_t max_concurrent_compat_parses = 16;
+
 constexpr auto set_accumulator =
   [](store::schema_id_set acc, store::schema_id_set refs) {
       acc.insert(refs.begin(), refs.end());
@@ -69,10 +78,39 @@ constexpr auto set_accumulator =
 
 ss::future<> sharded_store::start(ss::smp_service_group sg) {
     _smp_opts = ss::smp_submit_to_options{sg};
-    return _store.start();
+    co_await _store.start();
+    co_await _cache.start(read_cache_capacity);
+    co_await _valid_cache.start(ss::sharded_parameter([] {
+        return config::shard_local_cfg()
+          .schema_registry_parsed_schema_cache_bytes.bind();
+    }));
 }
 
-ss::future<> sharded_store::stop() { return _store.stop(); }
+ss::future<> sharded_store::stop() {
+    co_await _valid_cache.stop();
+    co_await _cache.stop();
+    co_await _store.stop();
+}
+
+ss::future<> sharded_store::enable_read_cache() {
+    co_await _cache.invoke_on_all(_smp_opts, [](read_cache& c) { c.enable(); });
+    // A write that raced with the above may have skipped the shards enabled
+    // before the one it ran on, it has been applied by now.
+    co_await invalidate_caches(true);
+}
+
+ss::future<> sharded_store::invalidate_caches(bool valid_schemas) {
+    // Nothing is cached on any shard before the caches are enabled
+    if (!_cache.local().enabled()) {
+        co_return;
+    }
+    co_await ss::smp::invoke_on_all(_smp_opts, [this, valid_schemas] {
+        _cache.local().invalidate();
+        if (valid_schemas) {
+            _valid_cache.local().invalidate();
+        }
+    });
+}
 
 ss::future<canonical_schema>
 sharded_store::make_canonical_schema(unparsed_schema schema) {
@@ -248,6 +286,9 @@ ss::future<bool> sharded_store::upsert(
 }
 
 ss::future<bool> sharded_store::has_schema(schema_id id) {
+    if (_cache.local().get_schema_definition(id)) {
+        co_return true;
+    }
     co_return co_await _store.invoke_on(
       shard_for(id), _smp_opts, [id](store& s) {
           return s.get_schema_definition(id).has_value();
@@ -289,10 +330,17 @@ ss::future<subject_schema> sharded_store::has_schema(canonical_schema schema) {
 
 ss::future<canonical_schema_definition>
 sharded_store::get_schema_definition(schema_id id) {
-    co_return co_await _store.invoke_on(
+    auto& cache = _cache.local();
+    if (auto def = cache.get_schema_definition(id)) {
+        co_return std::move(*def);
+    }
+    auto gen = cache.current();
+    auto def = co_await _store.invoke_on(
       shard_for(id), _smp_opts, [id](store& s) {
           return s.get_schema_definition(id).value();
       });
+    cache.put_schema_definition(gen, id, def);
+    co_return def;
 }
 
 ss::future<std::vector<subject_version>>
@@ -327,22 +375,26 @@ sharded_store::get_schema_subjects(schema_id id, include_deleted inc_del) {
 
 ss::future<subject_schema> sharded_store::get_subject_schema(
   subject sub, std::optional<schema_version> version, include_deleted inc_del) {
-    auto sub_shard{shard_for(sub)};
-    auto v_id = co_await _store.invoke_on(
-      sub_shard, _smp_opts, [sub, version, inc_del](store& s) {
-          return s.get_subject_version_id(sub, version, inc_del).value();
-      });
+    auto& cache = _cache.local();
+    auto v_id = cache.get_subject_version_id(sub, version, inc_del);
+    if (!v_id) {
+        auto gen = cache.current();
+        auto entry = co_await _store.invoke_on(
+          shard_for(sub), _smp_opts, [sub, version, inc_del](store& s) {
+              return s.get_subject_version_id(sub, version, inc_del).value();
+          });
+        v_id = read_cache::version_entry{
+          .version = entry.version, .id = entry.id, .deleted = entry.deleted};
+        cache.put_subject_version_id(gen, sub, version, inc_del, *v_id);
+    }
 
-    auto def = co_await _store.invoke_on(
-      shard_for(v_id.id), _smp_opts, [id{v_id.id}](store& s) {
-          return s.get_schema_definition(id).value();
-      });
+    auto def = co_await get_schema_definition(v_id->id);
 
     co_return subject_schema{
       .schema = {sub, std::move(def)},
-      .version = v_id.version,
-      .id = v_id.id,
-      .deleted = v_id.deleted};
+      .version = v_id->version,
+      .id = v_id->id,
+      .deleted = v_id->deleted};
 }
 
 ss::future<std::vector<subject>>
@@ -427,10 +479,12 @@ ss::future<std::vector<schema_id>> sharded_store::referenced_by(
 ss::future<std::vector<schema_version>> sharded_store::delete_subject(
   seq_marker marker, subject sub, permanent_delete permanent) {
     auto sub_shard{shard_for(sub)};
-    co_return co_await _store.invoke_on(
+    auto versions = co_await _store.invoke_on(
       sub_shard, _smp_opts, [marker, sub{std::move(sub)}, permanent](store& s) {
           return s.delete_subject(marker, sub, permanent).value();
       });
+    co_await invalidate_caches(true);
+    co_return versions;
 }
 
 ss::future<is_deleted> sharded_store::is_subject_deleted(subject sub) {
@@ -471,10 +525,12 @@ sharded_store::get_subject_version_written_at(subject sub, schema_version ver) {
 ss::future<bool>
 sharded_store::delete_subject_version(subject sub, schema_version ver) {
     auto sub_shard{shard_for(sub)};
-    co_return co_await _store.invoke_on(
+    auto deleted = co_await _store.invoke_on(
       sub_shard, _smp_opts, [sub{std::move(sub)}, ver](store& s) {
           return s.delete_subject_version(sub, ver).value();
       });
+    co_await invalidate_caches(true);
+    co_return deleted;
 }
 
 ss::future<compatibility_level> sharded_store::get_compatibility() {
@@ -521,10 +577,13 @@ ss::future<bool> sharded_store::clear_compatibility(subject sub) {
 ss::future<bool>
 sharded_store::upsert_schema(schema_id id, canonical_schema_definition def) {
     co_await maybe_update_max_schema_id(id);
-    co_return co_await _store.invoke_on(
+    auto inserted = co_await _store.invoke_on(
       shard_for(id), _smp_opts, [id, def{std::move(def)}](store& s) mutable {
           return s.upsert_schema(id, std::move(def));
       });
+    // The definition may have been replaced
+    co_await invalidate_caches(!inserted);
+    co_return inserted;
 }
 
 ss::future<sharded_store::insert_subject_result>
@@ -534,6 +593,7 @@ sharded_store::insert_subject(subject sub, schema_id id) {
       sub_shard, _smp_opts, [sub{std::move(sub)}, id](store& s) mutable {
           return s.insert_subject(sub, id);
       });
+    co_await invalidate_caches(false);
     co_return insert_subject_result{version, inserted};
 }
 
@@ -544,12 +604,15 @@ ss::future<bool> sharded_store::upsert_subject(
   schema_id id,
   is_deleted deleted) {
     auto sub_shard{shard_for(sub)};
-    co_return co_await _store.invoke_on(
+    auto inserted = co_await _store.invoke_on(
       sub_shard,
       _smp_opts,
       [marker, sub{std::move(sub)}, version, id, deleted](store& s) mutable {
           return s.upsert_subject(marker, std::move(sub), version, id, deleted);
       });
+    // An existing version may now be deleted, or refer to another schema
+    co_await invalidate_caches(!inserted);
+    co_return inserted;
 }
 
 /// \brief Get the schema ID to be used for next insert
@@ -634,16 +697,32 @@ ss::future<bool> sharded_store::is_compatible(
 
     auto new_valid = co_await make_valid_schema(new_schema);
 
-    auto is_compat = true;
-    for (; is_compat && ver_it != versions.end(); ++ver_it) {
-        if (ver_it->deleted) {
-            continue;
+    // Parse the versions to check against concurrently
+    std::vector<schema_version> check_versions;
+    for (; ver_it != versions.end(); ++ver_it) {
+        if (!ver_it->deleted) {
+            check_versions.push_back(ver_it->version);
         }
+    }
+    std::vector<std::optional<valid_schema>> old_valids(check_versions.size());
+    co_await ss::max_concurrent_for_each(
+      boost::irange(check_versions.size()),
+      max_concurrent_compat_parses,
+      [this, &sub, &check_versions, &old_valids](size_t i) {
+          return get_subject_schema(
+                   sub, check_versions[i], include_deleted::no)
+            .then([this](subject_schema old_schema) {
+                return get_valid_schema(
+                  old_schema.id, std::move(old_schema.schema));
+            })
+            .then([&old_valids, i](valid_schema valid) {
+                old_valids[i].emplace(std::move(valid));
+            });
+      });
 
-        auto old_schema = co_await get_subject_schema(
-          sub, ver_it->version, include_deleted::no);
-        auto old_valid = co_await make_valid_schema(old_schema.schema);
-
+    auto is_compat = true;
+    for (const auto& old : old_valids) {
+        const auto& old_valid = old.value();
         if (
           compat == compatibility_level::backward
           || compat == compatibility_level::backward_transitive
@@ -662,6 +741,23 @@ ss::future<bool> sharded_store::is_compatible(
     co_return is_compat;
 }
 
+ss::future<valid_schema>
+sharded_store::get_valid_schema(schema_id id, canonical_schema schema) {
+    // Writes only invalidate the parsed schemas once the caches are enabled
+    if (!_cache.local().enabled()) {
+        co_return co_await make_valid_schema(std::move(schema));
+    }
+    auto& cache = _valid_cache.local();
+    if (auto valid = cache.get(id)) {
+        co_return std::move(*valid);
+    }
+    auto gen = cache.current();
+    auto bytes = schema.def().raw()().size();
+    auto valid = co_await make_valid_schema(std::move(schema));
+    cache.put(gen, id, valid, bytes);
+    co_return valid;
+}
+
 ss::future<bool> sharded_store::has_version(
   const subject& sub, schema_id id, include_deleted i) {
     auto sub_shard{shard_for(sub)};
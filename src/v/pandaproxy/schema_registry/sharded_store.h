@@ -11,7 +11,9 @@
 
 #pragma once
 
+#include "pandaproxy/schema_registry/read_cache.h"
 #include "pandaproxy/schema_registry/types.h"
+#include "pandaproxy/schema_registry/valid_schema_cache.h"
 
 #include <seastar/core/sharded.hh>
 
@@ -26,6 +28,11 @@ public:
     ss::future<> start(ss::smp_service_group sg);
     ss::future<> stop();
 
+    ///\brief Serve lookups from the shard local caches from now on. Until
+    /// then writes skip invalidating the caches on every shard, which keeps
+    /// loading the store from the _schemas topic cheap.
+    ss::future<> enable_read_cache();
+
     ///\brief Make the canonical form of the schema
     ss::future<canonical_schema> make_canonical_schema(unparsed_schema schema);
 
@@ -159,8 +166,20 @@ private:
 
     ss::future<schema_id> project_schema_id();
 
+    ///\brief Construct the schema with \p id in the native format, or return
+    /// it from the cache of parsed schemas.
+    ss::future<valid_schema>
+    get_valid_schema(schema_id id, canonical_schema schema);
+
+    ///\brief Drop the cached lookups on every shard once a write has been
+    /// applied to the store, and the parsed schemas too if \p valid_schemas,
+    /// for writes that may change how references resolve.
+    ss::future<> invalidate_caches(bool valid_schemas);
+
     ss::smp_submit_to_options _smp_opts;
     ss::sharded<store> _store;
+    ss::sharded<read_cache> _cache;
+    ss::sharded<valid_schema_cache> _valid_cache;
 
     ///\brief Access must occur only on shard 0.
     schema_id _next_schema_id{1};
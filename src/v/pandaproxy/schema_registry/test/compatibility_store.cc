@@ -86,3 +86,44 @@ SEASTAR_THREAD_TEST_CASE(test_avro_basic_backwards_store_compat) {
                       {sub, pps::canonical_schema_definition{schema3}})
                      .get());
 }
+
+SEASTAR_THREAD_TEST_CASE(test_avro_store_compat_parsed_cache) {
+    pps::sharded_store s;
+    s.start(ss::default_smp_service_group()).get();
+    auto stop_store = ss::defer([&s]() { s.stop().get(); });
+
+    pps::seq_marker dummy_marker;
+
+    s.set_compatibility(pps::compatibility_level::backward).get();
+    auto sub = pps::subject{"sub"};
+    s.upsert(
+       dummy_marker,
+       {sub, pps::canonical_schema_definition{schema1}},
+       pps::schema_id{1},
+       pps::schema_version{1},
+       pps::is_deleted::no)
+      .get();
+
+    // Test non-defaulted field, twice to be served from the cache
+    for (int i = 0; i < 2; ++i) {
+        BOOST_REQUIRE(!s.is_compatible(
+                          pps::schema_version{1},
+                          {sub, pps::canonical_schema_definition{schema3}})
+                         .get());
+    }
+
+    // Overwrite the version with the defaulted field
+    s.upsert(
+       dummy_marker,
+       {sub, pps::canonical_schema_definition{schema2}},
+       pps::schema_id{2},
+       pps::schema_version{1},
+       pps::is_deleted::no)
+      .get();
+
+    // The parsed schema of the old version must not be used
+    BOOST_REQUIRE(s.is_compatible(
+                     pps::schema_version{1},
+                     {sub, pps::canonical_schema_definition{schema3}})
+                    .get());
+}
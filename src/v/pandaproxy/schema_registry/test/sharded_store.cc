@@ -131,3 +131,118 @@ SEASTAR_THREAD_TEST_CASE(test_sharded_store_find_unordered) {
     BOOST_REQUIRE_EQUAL(res.id, pps::schema_id{1});
     BOOST_REQUIRE_EQUAL(res.version, ver1);
 }
+
+SEASTAR_THREAD_TEST_CASE(test_sharded_store_read_cache) {
+    pps::sharded_store store;
+    store.start(ss::default_smp_service_group()).get();
+    auto stop_store = ss::defer([&store]() { store.stop().get(); });
+    store.enable_read_cache().get();
+
+    const pps::subject sub{"cached"};
+    const pps::schema_version ver1{1};
+    const pps::schema_version ver2{2};
+    auto marker = [](pps::schema_version ver) {
+        return pps::seq_marker{
+          std::nullopt, std::nullopt, ver, pps::seq_marker_key_type::schema};
+    };
+    pps::canonical_schema_definition int_def{
+      R"({"type":"int"})", pps::schema_type::avro};
+    pps::canonical_schema_definition long_def{
+      R"({"type":"long"})", pps::schema_type::avro};
+
+    store
+      .upsert(
+        marker(ver1),
+        pps::canonical_schema{sub, int_def},
+        pps::schema_id{1},
+        ver1,
+        pps::is_deleted::no)
+      .get();
+
+    auto latest = [&]() {
+        return store
+          .get_subject_schema(sub, std::nullopt, pps::include_deleted::no)
+          .get();
+    };
+
+    // Populate the cache
+    auto res = latest();
+    BOOST_REQUIRE_EQUAL(res.version, ver1);
+    BOOST_REQUIRE(
+      store.get_schema_definition(pps::schema_id{1}).get() == int_def);
+
+    // A new version must be seen by the next lookup of the latest
+    store
+      .upsert(
+        marker(ver2),
+        pps::canonical_schema{sub, long_def},
+        pps::schema_id{2},
+        ver2,
+        pps::is_deleted::no)
+      .get();
+    res = latest();
+    BOOST_REQUIRE_EQUAL(res.version, ver2);
+    BOOST_REQUIRE_EQUAL(res.id, pps::schema_id{2});
+    BOOST_REQUIRE(res.schema.def() == long_def);
+
+    // Soft deleting hides the version
+    store
+      .upsert(
+        marker(ver2),
+        pps::canonical_schema{sub, long_def},
+        pps::schema_id{2},
+        ver2,
+        pps::is_deleted::yes)
+      .get();
+    res = latest();
+    BOOST_REQUIRE_EQUAL(res.version, ver1);
+    res = store.get_subject_schema(sub, ver2, pps::include_deleted::yes).get();
+    BOOST_REQUIRE(res.deleted);
+
+    // Permanently deleting removes it
+    store.delete_subject_version(sub, ver2).get();
+    BOOST_REQUIRE_THROW(
+      store.get_subject_schema(sub, ver2, pps::include_deleted::yes).get(),
+      pps::exception);
+}
+
+SEASTAR_THREAD_TEST_CASE(test_sharded_store_read_cache_enabled_after_load) {
+    pps::sharded_store store;
+    store.start(ss::default_smp_service_group()).get();
+    auto stop_store = ss::defer([&store]() { store.stop().get(); });
+
+    const pps::subject sub{"loaded"};
+    pps::canonical_schema_definition int_def{
+      R"({"type":"int"})", pps::schema_type::avro};
+    auto upsert = [&](pps::schema_version ver) {
+        store
+          .upsert(
+            pps::seq_marker{
+              std::nullopt,
+              std::nullopt,
+              ver,
+              pps::seq_marker_key_type::schema},
+            pps::canonical_schema{sub, int_def},
+            pps::schema_id{ver()},
+            ver,
+            pps::is_deleted::no)
+          .get();
+    };
+    auto latest = [&]() {
+        return store
+          .get_subject_schema(sub, std::nullopt, pps::include_deleted::no)
+          .get()
+          .version;
+    };
+
+    // Writes while loading skip invalidating, lookups are not cached
+    upsert(pps::schema_version{1});
+    BOOST_REQUIRE_EQUAL(latest(), pps::schema_version{1});
+    upsert(pps::schema_version{2});
+    BOOST_REQUIRE_EQUAL(latest(), pps::schema_version{2});
+
+    store.enable_read_cache().get();
+    BOOST_REQUIRE_EQUAL(latest(), pps::schema_version{2});
+    upsert(pps::schema_version{3});
+    BOOST_REQUIRE_EQUAL(latest(), pps::schema_version{3});
+}
@@ -0,0 +1,121 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "config/property.h"
+#include "pandaproxy/schema_registry/types.h"
+#include "seastarx.h"
+
+#include <boost/multi_index/hashed_index.hpp>
+#include <boost/multi_index/indexed_by.hpp>
+#include <boost/multi_index/member.hpp>
+#include <boost/multi_index/sequenced_index.hpp>
+#include <boost/multi_index_container.hpp>
+
+#include <cstdint>
+#include <optional>
+
+namespace pandaproxy::schema_registry {
+
+///\brief A shard local MRU cache of parsed schemas, by schema id.
+///
+/// Parsing a schema resolves its references through the store, so an entry
+/// is only valid as long as the subject versions it references keep their
+/// schema ids. Writes that could change that (deletes and overwrites of a
+/// version) invalidate the whole cache; registering new versions does not.
+///
+/// Memory is accounted by the size of the canonical definition, which is a
+/// lower bound of the size of the parsed form.
+class valid_schema_cache {
+public:
+    using generation = uint64_t;
+
+    explicit valid_schema_cache(config::binding<size_t> max_bytes)
+      : _max_bytes{std::move(max_bytes)} {
+        _max_bytes.watch([this]() { shrink_to_capacity(); });
+    }
+
+    ///\brief The generation to pass to put for a parse starting now.
+    generation current() const { return _generation; }
+
+    void invalidate() {
+        ++_generation;
+        _cache.clear();
+        _bytes = 0;
+    }
+
+    std::optional<valid_schema> get(schema_id id) {
+        auto& map = _cache.get<underlying_map>();
+        auto it = map.find(id);
+        if (it == map.end()) {
+            return std::nullopt;
+        }
+        auto& list = _cache.get<underlying_list>();
+        list.relocate(list.begin(), _cache.project<underlying_list>(it));
+        return it->schema;
+    }
+
+    void put(generation gen, schema_id id, valid_schema schema, size_t bytes) {
+        if (gen != _generation || bytes > _max_bytes()) {
+            return;
+        }
+        auto& list = _cache.get<underlying_list>();
+        auto [it, inserted] = list.emplace_front(id, std::move(schema), bytes);
+        if (inserted) {
+            _bytes += bytes;
+            shrink_to_capacity();
+        }
+    }
+
+    size_t size_bytes() const { return _bytes; }
+
+private:
+    // Truncate the cache from the back of the sequence
+    void shrink_to_capacity() {
+        auto& list = _cache.get<underlying_list>();
+        while (!list.empty() && _bytes > _max_bytes()) {
+            _bytes -= list.back().bytes;
+            list.pop_back();
+        }
+    }
+
+    struct entry {
+        entry(schema_id id, valid_schema schema, size_t bytes)
+          : id{id}
+          , schema{std::move(schema)}
+          , bytes{bytes} {}
+
+        schema_id id;
+        valid_schema schema;
+        size_t bytes;
+    };
+
+    struct underlying_list {};
+    struct underlying_map {};
+    using underlying_t = boost::multi_index::multi_index_container<
+      entry,
+      boost::multi_index::indexed_by<
+        // Sequenced list of entries, most recently used first
+        boost::multi_index::sequenced<boost::multi_index::tag<underlying_list>>,
+        // Entries by schema id
+        boost::multi_index::hashed_unique<
+          boost::multi_index::tag<underlying_map>,
+          boost::multi_index::member<entry, schema_id, &entry::id>,
+          std::hash<schema_id>>>>;
+
+    underlying_t _cache;
+    config::binding<size_t> _max_bytes;
+    generation _generation{0};
+    size_t _bytes{0};
+};
+
+} // namespace pandaproxy::schema_registry
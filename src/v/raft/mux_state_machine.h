@@ -34,6 +34,7 @@
 #include <absl/container/flat_hash_set.h>
 #include <absl/container/node_hash_map.h>
 
+#include <array>
 #include <optional>
 #include <system_error>
 #include <variant>
@@ -229,6 +230,19 @@ protected:
     // we keep states in a tuple to automatically dispatch updates to correct
     // state
     std::tuple<T&...> _state;
+
+    /// Generation of the given state, bumped whenever a batch is dispatched
+    /// to it or a snapshot is applied. Lets the snapshotting code tell which
+    /// states did not change since it last looked at them.
+    template<typename State>
+    uint64_t state_generation() const {
+        constexpr auto idx
+          = std::variant<T*...>{std::in_place_type<State*>}.index();
+        return _state_generations[idx];
+    }
+
+private:
+    std::array<uint64_t, sizeof...(T)> _state_generations{};
 };
 
 template<typename... T>
@@ -398,6 +412,10 @@ ss::future<> mux_state_machine<T...>::do_apply(model::record_batch b) {
         return ss::now();
     }
 
+    // bumped before applying so that a failed update still invalidates
+    // anything derived from the previous state
+    ++_state_generations[state->index()];
+
     auto last_offset = b.last_offset();
     // apply update
     auto result_f = std::visit(
@@ -450,6 +468,9 @@ ss::future<> mux_state_machine<T...>::handle_raft_snapshot() {
 
     auto apply_mtx_holder = co_await _apply_mtx.get_units();
 
+    for (auto& generation : _state_generations) {
+        ++generation;
+    }
     co_await apply_snapshot(snapshot_offset, snap->reader).finally([&snap] {
         return snap->close();
     });
@@ -13,6 +13,7 @@
 
 #include "raft/consensus_utils.h"
 #include "raft/logger.h"
+#include "serde/serde.h"
 #include "storage/api.h"
 #include "storage/kvstore.h"
 #include "vlog.h"
@@ -71,6 +72,36 @@ namespace {
 enum class kvstore_key_type : int8_t {
     offsets_map = 0,
     highest_known_offset = 1,
+    offsets_map_tail = 2,
+};
+
+struct persisted_gap {
+    model::offset base_offset;
+    model::offset last_offset;
+
+    friend inline void read_nested(
+      iobuf_parser& in, persisted_gap& g, size_t const bytes_left_limit) {
+        serde::read_nested(in, g.base_offset, bytes_left_limit);
+        serde::read_nested(in, g.last_offset, bytes_left_limit);
+    }
+
+    friend inline void write(iobuf& out, const persisted_gap& g) {
+        serde::write(out, g.base_offset);
+        serde::write(out, g.last_offset);
+    }
+};
+
+// Gaps appended after the last full checkpoint of the offsets map.
+struct offsets_map_tail
+  : serde::envelope<
+      offsets_map_tail,
+      serde::version<0>,
+      serde::compat_version<0>> {
+    // Highest known offset persisted along with the map this tail extends,
+    // used to detect a tail left over from an earlier map.
+    model::offset base_highest_known_offset;
+    model::offset highest_known_offset;
+    std::vector<persisted_gap> gaps;
 };
 
 bytes serialize_kvstore_key(raft::group_id group, kvstore_key_type key_type) {
@@ -90,6 +121,10 @@ bytes offset_translator::kvstore_highest_known_offset_key(
     return serialize_kvstore_key(group, kvstore_key_type::highest_known_offset);
 }
 
+bytes offset_translator::kvstore_offsetmap_tail_key(raft::group_id group) {
+    return serialize_kvstore_key(group, kvstore_key_type::offsets_map_tail);
+}
+
 ss::future<>
 offset_translator::start(must_reset reset, bootstrap_state&& bootstrap) {
     vassert(
@@ -106,7 +141,7 @@ offset_translator::start(must_reset reset, bootstrap_state&& bootstrap) {
 
         *_state = storage::offset_translator_state(
           _state->ntp(), model::offset::min(), 0);
-        ++_map_version;
+        map_rewritten();
         _highest_known_offset = model::offset::min();
 
         co_await _checkpoint_lock.with([this] { return do_checkpoint(); });
@@ -123,6 +158,37 @@ offset_translator::start(must_reset reset, bootstrap_state&& bootstrap) {
             _highest_known_offset = reflection::from_iobuf<model::offset>(
               std::move(*highest_known_offset_buf));
 
+            _full_checkpoint_size = _state->size();
+            _full_last_gap_offset = _state->last_gap_offset();
+            _full_highest_known_offset = _highest_known_offset;
+
+            auto tail_buf = _storage_api.kvs().get(
+              storage::kvstore::key_space::offset_translator,
+              kvstore_offsetmap_tail_key(_group));
+            if (tail_buf) {
+                _tail_persisted = true;
+                auto tail = serde::from_iobuf<offsets_map_tail>(
+                  std::move(*tail_buf));
+                if (
+                  tail.base_highest_known_offset
+                  == _full_highest_known_offset) {
+                    for (const auto& g : tail.gaps) {
+                        _state->add_gap(g.base_offset, g.last_offset);
+                    }
+                    _highest_known_offset = std::max(
+                      _highest_known_offset, tail.highest_known_offset);
+                } else {
+                    vlog(
+                      _logger.warn,
+                      "ignoring offset map tail for highest known offset {}, "
+                      "expected {}",
+                      tail.base_highest_known_offset,
+                      _full_highest_known_offset);
+                    // next checkpoint rewrites the map and drops the tail
+                    map_rewritten();
+                }
+            }
+
             // highest known offset could be more stale than the map, in
             // this case we take it from the map
             _highest_known_offset = std::max(
@@ -137,7 +203,7 @@ offset_translator::start(must_reset reset, bootstrap_state&& bootstrap) {
 
             *_state = storage::offset_translator_state::from_bootstrap_state(
               _state->ntp(), bootstrap.offset2delta);
-            ++_map_version;
+            map_rewritten();
             _highest_known_offset = bootstrap.highest_known_offset;
 
             co_await _checkpoint_lock.with([this] { return do_checkpoint(); });
@@ -172,7 +238,7 @@ ss::future<> offset_translator::sync_with_log(
     // Trim the offset2delta map to log dirty_offset (discrepancy can
     // happen if the offsets map was persisted, but the log wasn't flushed).
     if (_state->truncate(model::next_offset(log_offsets.dirty_offset))) {
-        ++_map_version;
+        map_rewritten();
     }
 
     if (log_offsets.dirty_offset < _highest_known_offset) {
@@ -234,7 +300,7 @@ ss::future<> offset_translator::truncate(model::offset offset) {
     }
 
     if (_state->truncate(offset)) {
-        ++_map_version;
+        map_rewritten();
     }
 
     model::offset prev = model::prev_offset(offset);
@@ -262,7 +328,7 @@ ss::future<> offset_translator::prefix_truncate(model::offset offset) {
         co_return;
     }
 
-    ++_map_version;
+    map_rewritten();
 
     vlog(
       _logger.debug,
@@ -293,7 +359,7 @@ offset_translator::prefix_truncate_reset(model::offset offset, int64_t delta) {
       _state);
 
     *_state = storage::offset_translator_state(_state->ntp(), offset, delta);
-    ++_map_version;
+    map_rewritten();
 
     _highest_known_offset = offset;
 
@@ -314,6 +380,9 @@ ss::future<> offset_translator::remove_persistent_state() {
     co_await _storage_api.kvs().remove(
       storage::kvstore::key_space::offset_translator,
       highest_known_offset_key());
+    co_await _storage_api.kvs().remove(
+      storage::kvstore::key_space::offset_translator,
+      kvstore_offsetmap_tail_key(_group));
     co_await _storage_api.kvs().remove(
       storage::kvstore::key_space::offset_translator, offsets_map_key());
 }
@@ -361,29 +430,87 @@ ss::future<> offset_translator::do_checkpoint() {
     size_t bytes_processed = _bytes_processed;
     size_t map_version = _map_version;
 
-    std::optional<iobuf> map_buf;
-    if (map_version > _map_version_at_checkpoint) {
-        map_buf.emplace(_state->serialize_map());
+    if (_map_rewrite_version > _map_version_at_full_checkpoint) {
+        co_return co_await do_full_checkpoint(bytes_processed, map_version);
     }
 
-    iobuf hko_buf = reflection::to_iobuf(_highest_known_offset);
+    if (map_version == _map_version_at_full_checkpoint && !_tail_persisted) {
+        // The persisted map is up to date, only the highest known offset
+        // moved.
+        auto hko = _highest_known_offset;
+        co_await _storage_api.kvs().put(
+          storage::kvstore::key_space::offset_translator,
+          highest_known_offset_key(),
+          reflection::to_iobuf(hko));
+        _full_highest_known_offset = hko;
+    } else {
+        // Only gaps were appended since the last full checkpoint: persist
+        // those, unless rewriting the whole map is about as cheap.
+        auto gaps = _state->gaps_after(_full_last_gap_offset);
+        if (gaps.size() >= _full_checkpoint_size) {
+            co_return co_await do_full_checkpoint(bytes_processed, map_version);
+        }
 
-    // Persisting offsets map before highest offset so that if the latter
-    // fails, we are still left with a consistent state (map can be
-    // recreated by reading log from the highest known offset).
+        offsets_map_tail tail{
+          .base_highest_known_offset = _full_highest_known_offset,
+          .highest_known_offset = _highest_known_offset,
+        };
+        tail.gaps.reserve(gaps.size());
+        for (const auto& g : gaps) {
+            tail.gaps.push_back(persisted_gap{
+              .base_offset = g.base_offset, .last_offset = g.last_offset});
+        }
 
-    if (map_buf) {
         co_await _storage_api.kvs().put(
           storage::kvstore::key_space::offset_translator,
-          offsets_map_key(),
-          std::move(*map_buf));
-        _map_version_at_checkpoint = map_version;
+          kvstore_offsetmap_tail_key(_group),
+          serde::to_iobuf(std::move(tail)));
+        _tail_persisted = true;
     }
 
+    _bytes_processed_at_checkpoint = bytes_processed;
+    _bytes_processed_units.return_all();
+
+    _checkpoint_hint = false;
+}
+
+ss::future<> offset_translator::do_full_checkpoint(
+  size_t bytes_processed, size_t map_version) {
+    // Called from do_checkpoint() before its first suspension point, so the
+    // state read here is still consistent with `map_version`.
+    iobuf map_buf = _state->serialize_map();
+    auto map_size = _state->size();
+    auto last_gap_offset = _state->last_gap_offset();
+    auto hko = _highest_known_offset;
+    iobuf hko_buf = reflection::to_iobuf(hko);
+
+    // The tail is removed first: the previous map and highest known offset
+    // make a consistent state on their own, while the tail wouldn't match the
+    // new map.
+    if (_tail_persisted) {
+        co_await _storage_api.kvs().remove(
+          storage::kvstore::key_space::offset_translator,
+          kvstore_offsetmap_tail_key(_group));
+        _tail_persisted = false;
+    }
+
+    // Persisting offsets map before highest offset so that if the latter
+    // fails, we are still left with a consistent state (map can be
+    // recreated by reading log from the highest known offset).
+
+    co_await _storage_api.kvs().put(
+      storage::kvstore::key_space::offset_translator,
+      offsets_map_key(),
+      std::move(map_buf));
+    _map_version_at_full_checkpoint = map_version;
+    _full_checkpoint_size = map_size;
+    _full_last_gap_offset = last_gap_offset;
+
     co_await _storage_api.kvs().put(
       storage::kvstore::key_space::offset_translator,
       highest_known_offset_key(),
       std::move(hko_buf));
+    _full_highest_known_offset = hko;
     _bytes_processed_at_checkpoint = bytes_processed;
     _bytes_processed_units.return_all();
 
@@ -398,6 +525,7 @@ ss::future<> offset_translator::move_persistent_state(
     struct ot_state {
         std::optional<iobuf> highest_known_offset;
         std::optional<iobuf> offset_map;
+        std::optional<iobuf> offset_map_tail;
     };
     using state_ptr = std::unique_ptr<ot_state>;
     vlog(
@@ -416,6 +544,9 @@ ss::future<> offset_translator::move_persistent_state(
                 gr, kvstore_key_type::highest_known_offset)),
             .offset_map = api.kvs().get(
               ks, serialize_kvstore_key(gr, kvstore_key_type::offsets_map)),
+            .offset_map_tail = api.kvs().get(
+              ks,
+              serialize_kvstore_key(gr, kvstore_key_type::offsets_map_tail)),
           };
           return ss::make_foreign<state_ptr>(
             std::make_unique<ot_state>(std::move(st)));
@@ -426,7 +557,7 @@ ss::future<> offset_translator::move_persistent_state(
       [gr = group,
        state = std::move(state)](storage::api& api) -> ss::future<> {
           std::vector<ss::future<>> write_futures;
-          write_futures.reserve(2);
+          write_futures.reserve(3);
           if (state->offset_map) {
               write_futures.push_back(api.kvs().put(
                 ks,
@@ -440,6 +571,12 @@ ss::future<> offset_translator::move_persistent_state(
                   gr, kvstore_key_type::highest_known_offset),
                 state->highest_known_offset->copy()));
           }
+          if (state->offset_map_tail) {
+              write_futures.push_back(api.kvs().put(
+                ks,
+                serialize_kvstore_key(gr, kvstore_key_type::offsets_map_tail),
+                state->offset_map_tail->copy()));
+          }
 
           return ss::when_all_succeed(
             write_futures.begin(), write_futures.end());
@@ -448,12 +585,14 @@ ss::future<> offset_translator::move_persistent_state(
     // remove on source shard
     co_await api.invoke_on(source_shard, [gr = group](storage::api& api) {
         std::vector<ss::future<>> remove_futures;
-        remove_futures.reserve(2);
+        remove_futures.reserve(3);
         remove_futures.push_back(api.kvs().remove(
           ks,
           serialize_kvstore_key(gr, kvstore_key_type::highest_known_offset)));
         remove_futures.push_back(api.kvs().remove(
           ks, serialize_kvstore_key(gr, kvstore_key_type::offsets_map)));
+        remove_futures.push_back(api.kvs().remove(
+          ks, serialize_kvstore_key(gr, kvstore_key_type::offsets_map_tail)));
         return ss::when_all_succeed(
           remove_futures.begin(), remove_futures.end());
     });
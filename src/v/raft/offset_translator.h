@@ -36,6 +36,13 @@ namespace raft {
 /// periodically checkpointed to the kvstore. As log truncations/raft snapshots
 /// happen, the map is truncated/prefix-truncated along with the log.
 ///
+/// Checkpoints are incremental: while the map only grows at the end, just
+/// the batches appended since the last full checkpoint are written, under a
+/// separate key, together with the highest known offset. The full map is
+/// rewritten once that tail grows as large as the map itself or the map is
+/// truncated. The highest known offset key is left pointing at the full map,
+/// so a reader unaware of the tail still recovers by reading the log.
+///
 /// Concurrency note: `start`, `sync_with_log` and `remove_persistent_state`
 /// methods can't be called concurrently with other non-const methods and
 /// require external synchronization. Other methods are safe to call
@@ -121,8 +128,16 @@ public:
     /// Generate kv-store highest-known-offset key
     static bytes kvstore_highest_known_offset_key(raft::group_id group);
 
+    /// Generate kv-store key for the offset map tail
+    static bytes kvstore_offsetmap_tail_key(raft::group_id group);
+
 private:
     ss::future<> do_checkpoint();
+    ss::future<> do_full_checkpoint(size_t bytes_processed, size_t map_version);
+
+    // Records a map change other than appending a gap, after which the next
+    // checkpoint has to rewrite the full map.
+    void map_rewritten() { _map_rewrite_version = ++_map_version; }
 
 private:
     std::vector<model::record_batch_type> _filtered_types;
@@ -149,7 +164,18 @@ private:
     mutex _checkpoint_lock;
 
     size_t _bytes_processed_at_checkpoint = 0;
-    size_t _map_version_at_checkpoint = 0;
+
+    // Map version of the last change that wasn't an append.
+    size_t _map_rewrite_version = 0;
+
+    // What the full map and highest known offset keys in the kvstore
+    // currently describe; everything appended after _full_last_gap_offset is
+    // persisted in the tail key, if _tail_persisted.
+    size_t _map_version_at_full_checkpoint = 0;
+    size_t _full_checkpoint_size = 0;
+    model::offset _full_last_gap_offset;
+    model::offset _full_highest_known_offset;
+    bool _tail_persisted{false};
 
     storage::api& _storage_api;
 };
@@ -12,6 +12,7 @@
 #include "raft/state_machine_manager.h"
 
 #include "bytes/iostream.h"
+#include "config/configuration.h"
 #include "config/property.h"
 #include "model/fundamental.h"
 #include "model/timeout_clock.h"
@@ -24,7 +25,9 @@
 #include "storage/snapshot.h"
 #include "storage/types.h"
 #include "utils/mutex.h"
+#include "vassert.h"
 
+#include <seastar/core/shared_future.hh>
 #include <seastar/core/shared_ptr.hh>
 #include <seastar/core/sstring.hh>
 #include <seastar/core/with_scheduling_group.hh>
@@ -43,7 +46,13 @@ namespace raft {
 /**
  * Applicator which is a batch consumer that applies the same batch to multiple
  * state machines. If one of the STMs throws an exception from `apply` method
- * then not further batches are applied to that STM but the others continue
+ * then not further batches are applied to that STM but the others continue.
+ *
+ * When given a manager to detach to, an STM which does not finish applying a
+ * batch within the apply timeout is detached as well: the others stop waiting
+ * for it and the manager completes the apply and catches the STM up in its
+ * background apply fiber. The last STM still applying is never detached so
+ * that the manager keeps making progress.
  */
 class batch_applicator {
 public:
@@ -51,7 +60,8 @@ public:
       const char* ctx,
       const std::vector<state_machine_manager::entry_ptr>& machines,
       ss::abort_source& as,
-      ctx_log& log);
+      ctx_log& log,
+      state_machine_manager* detach_to = nullptr);
 
     ss::future<ss::stop_iteration> operator()(model::record_batch);
 
@@ -61,27 +71,32 @@ private:
     struct apply_state {
         state_machine_manager::entry_ptr stm_entry;
         bool error{false};
+        bool detached{false};
     };
     using applied_successfully
       = ss::bool_class<struct applied_successfully_tag>;
     ss::future<applied_successfully>
     apply_to_stm(const model::record_batch& batch, apply_state& state);
+    bool can_detach() const;
 
     const char* _ctx;
     std::vector<apply_state> _machines;
     model::offset _max_last_applied;
     ss::abort_source& _as;
     ctx_log& _log;
+    state_machine_manager* _detach_to;
 };
 
 batch_applicator::batch_applicator(
   const char* ctx,
   const std::vector<state_machine_manager::entry_ptr>& entries,
   ss::abort_source& as,
-  ctx_log& log)
+  ctx_log& log,
+  state_machine_manager* detach_to)
   : _ctx(ctx)
   , _as(as)
-  , _log(log) {
+  , _log(log)
+  , _detach_to(detach_to) {
     for (auto& m : entries) {
         _machines.push_back(apply_state{.stm_entry = m});
     }
@@ -93,7 +108,7 @@ batch_applicator::operator()(model::record_batch batch) {
     std::vector<ss::future<applied_successfully>> futures;
     futures.reserve(_machines.size());
     for (auto& state : _machines) {
-        if (state.error) {
+        if (state.error || state.detached) {
             continue;
         }
         futures.push_back(apply_to_stm(batch, state));
@@ -137,8 +152,39 @@ batch_applicator::apply_to_stm(
             co_return applied_successfully::no;
         }
 
-        co_await state.stm_entry->stm->apply(batch);
-        state.stm_entry->stm->set_next(model::next_offset(last_offset));
+        /**
+         * A detached apply outlives the batch owned by the reader, it is
+         * given its own copy which is kept until the apply finishes.
+         */
+        const bool detachable = can_detach();
+        ss::lw_shared_ptr<model::record_batch> owned;
+        if (detachable) {
+            owned = ss::make_lw_shared<model::record_batch>(batch.copy());
+        }
+        auto applied
+          = state.stm_entry->stm->apply(owned ? *owned : batch)
+              .then([stm = state.stm_entry->stm, last_offset, owned] {
+                  stm->set_next(model::next_offset(last_offset));
+              });
+        if (applied.available() || !detachable) {
+            co_await std::move(applied);
+            co_return applied_successfully::yes;
+        }
+
+        ss::shared_future<> pending(std::move(applied));
+        auto in_time = co_await ss::coroutine::as_future(pending.get_future(
+          ss::lowres_clock::now() + _detach_to->_apply_timeout()));
+        if (in_time.failed()) {
+            auto e = in_time.get_exception();
+            try {
+                std::rethrow_exception(e);
+            } catch (const ss::timed_out_error&) {
+                state.detached = true;
+                _detach_to->detach_apply(
+                  state.stm_entry, pending.get_future());
+                co_return applied_successfully::no;
+            }
+        }
         co_return applied_successfully::yes;
     } catch (...) {
         vlog(
@@ -153,11 +199,25 @@ batch_applicator::apply_to_stm(
     }
 }
 
+bool batch_applicator::can_detach() const {
+    if (
+      _detach_to == nullptr
+      || _detach_to->_apply_timeout() == std::chrono::milliseconds::zero()) {
+        return false;
+    }
+    return std::count_if(
+             _machines.begin(),
+             _machines.end(),
+             [](const apply_state& s) { return !s.error && !s.detached; })
+           > 1;
+}
+
 state_machine_manager::state_machine_manager(
   consensus* raft, std::vector<stm_ptr> stms, ss::scheduling_group apply_sg)
   : _raft(raft)
   , _log(ctx_log(_raft->group(), _raft->ntp()))
-  , _apply_sg(apply_sg) {
+  , _apply_sg(apply_sg)
+  , _apply_timeout(config::shard_local_cfg().stm_apply_timeout_ms.bind()) {
     for (auto& stm : stms) {
         std::string_view name = stm->get_name();
         _machines.try_emplace(
@@ -334,7 +394,7 @@ ss::future<> state_machine_manager::apply() {
             }
         }
         auto last_applied = co_await std::move(reader).consume(
-          batch_applicator(default_ctx, machines, _as, _log),
+          batch_applicator(default_ctx, machines, _as, _log, this),
           model::no_timeout);
 
         _next = std::max(model::next_offset(last_applied), _next);
@@ -387,6 +447,52 @@ void state_machine_manager::maybe_start_background_apply(
     });
 }
 
+void state_machine_manager::detach_apply(
+  const entry_ptr& entry, ss::future<> applied) {
+    vlog(
+      _log.debug,
+      "'{}' state machine did not apply a batch within {}, continuing in "
+      "background",
+      entry->stm->get_name(),
+      _apply_timeout());
+    /**
+     * Holding the background apply mutex until the apply finishes keeps the
+     * entry out of the default apply fiber and makes snapshots wait for it.
+     * No other fiber holds it as the entry was selected by the default fiber.
+     */
+    auto units = entry->background_apply_mutex.try_get_units();
+    vassert(
+      units.has_value(),
+      "background apply mutex of '{}' state machine is already held",
+      entry->stm->get_name());
+    ssx::spawn_with_gate(
+      _gate,
+      [this, entry, applied = std::move(applied), units = std::move(units)](
+      ) mutable {
+          return std::move(applied).then_wrapped(
+            [this, entry, units = std::move(units)](ss::future<> f) mutable {
+                units.reset();
+                if (f.failed()) {
+                    /**
+                     * Same as an apply failing in the applicator, the state
+                     * machine is errored and left behind, the batch is not
+                     * applied again from here.
+                     */
+                    vlog(
+                      _log.warn,
+                      "[{}][{}] error applying batch - {}",
+                      background_ctx,
+                      entry->stm->get_name(),
+                      f.get_exception());
+                    return;
+                }
+                if (!_as.abort_requested()) {
+                    maybe_start_background_apply(entry);
+                }
+            });
+      });
+}
+
 ss::future<> state_machine_manager::background_apply_fiber(entry_ptr entry) {
     while (!_as.abort_requested() && entry->stm->next() < _next) {
         storage::log_reader_config config(
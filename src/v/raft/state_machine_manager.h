@@ -45,9 +45,10 @@ concept StateMachineIterateFunc = requires(
  * built on top of replicated log. State machine managers uses a single
  * fiber to read and apply record batches to all managed state machines.
  *
- * When a machine throws an exception or timeouts when applying batches to
- * its state subsequent applies are executed in the separate apply fiber
- * specific for that STM.
+ * When a machine throws an exception or, if `stm_apply_timeout_ms` is set,
+ * does not apply a batch within it, subsequent applies are executed in the
+ * separate apply fiber specific for that STM, so that a slow STM does not
+ * hold back the others.
  *
  * State machine manager also takes care of the snapshot consistency. It
  * wraps state machine snapshots in its own snapshot format which is a map
@@ -114,6 +115,7 @@ private:
     using state_machines_t = absl::flat_hash_map<ss::sstring, entry_ptr>;
 
     void maybe_start_background_apply(const entry_ptr&);
+    void detach_apply(const entry_ptr&, ss::future<>);
     ss::future<> background_apply_fiber(entry_ptr);
 
     ss::future<> apply_raft_snapshot();
@@ -148,6 +150,7 @@ private:
     ss::gate _gate;
     ss::abort_source _as;
     ss::scheduling_group _apply_sg;
+    config::binding<std::chrono::milliseconds> _apply_timeout;
 };
 
 /**
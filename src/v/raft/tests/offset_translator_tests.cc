@@ -691,3 +691,64 @@ FIXTURE_TEST(test_moving_persistent_state, base_fixture) {
     BOOST_REQUIRE_EQUAL(map.has_value(), false);
     BOOST_REQUIRE_EQUAL(highest_known_offset.has_value(), false);
 }
+
+FIXTURE_TEST(test_incremental_checkpoints, base_fixture) {
+    static constexpr auto ks = storage::kvstore::key_space::offset_translator;
+    auto tail_key = raft::offset_translator::kvstore_offsetmap_tail_key(
+      raft::group_id(0));
+
+    auto ot = make_offset_translator();
+    ot.start(raft::offset_translator::must_reset::yes, {}).get();
+
+    // every even offset is a configuration batch, every odd one data
+    auto append = [&ot](int64_t from, int64_t to) {
+        for (auto o = from; o < to; ++o) {
+            ot.process(create_batch(
+              o % 2 == 0 ? model::record_batch_type::raft_configuration
+                         : model::record_batch_type::raft_data,
+              model::offset(o)));
+        }
+    };
+    auto validate = [](raft::offset_translator& tr, int64_t to) {
+        for (auto o = 1; o < to; o += 2) {
+            validate_translation(tr, model::offset(o), model::offset(o / 2));
+        }
+    };
+
+    // the map outgrows the persisted one, so it is written in full
+    append(0, 40);
+    ot.maybe_checkpoint(0).get();
+    BOOST_REQUIRE(!_api.local().kvs().get(ks, tail_key));
+    auto full_map = _api.local().kvs().get(ks, ot.offsets_map_key());
+    auto full_hko = _api.local().kvs().get(ks, ot.highest_known_offset_key());
+    BOOST_REQUIRE(full_map && full_hko);
+
+    // a few more gaps only go into the tail
+    append(40, 50);
+    ot.maybe_checkpoint(0).get();
+    BOOST_REQUIRE(_api.local().kvs().get(ks, tail_key));
+    BOOST_REQUIRE_EQUAL(
+      *_api.local().kvs().get(ks, ot.offsets_map_key()), *full_map);
+    BOOST_REQUIRE_EQUAL(
+      *_api.local().kvs().get(ks, ot.highest_known_offset_key()), *full_hko);
+    validate(ot, 50);
+
+    {
+        auto restarted = make_offset_translator();
+        restarted.start(raft::offset_translator::must_reset::no, {}).get();
+        validate(restarted, 50);
+        BOOST_REQUIRE_EQUAL(
+          restarted.state()->last_gap_offset(), model::offset(48));
+    }
+
+    // truncation rewrites the map and drops the tail
+    ot.truncate(model::offset(44)).get();
+    BOOST_REQUIRE(!_api.local().kvs().get(ks, tail_key));
+    {
+        auto restarted = make_offset_translator();
+        restarted.start(raft::offset_translator::must_reset::no, {}).get();
+        validate(restarted, 44);
+        BOOST_REQUIRE_EQUAL(
+          restarted.state()->last_gap_offset(), model::offset(42));
+    }
+}
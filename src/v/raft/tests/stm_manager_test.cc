@@ -8,6 +8,7 @@
 // by the Apache License, Version 2.0
 
 #include "bytes/iostream.h"
+#include "config/configuration.h"
 #include "model/fundamental.h"
 #include "model/metadata.h"
 #include "model/record.h"
@@ -29,6 +30,7 @@
 #include "test_utils/test.h"
 
 #include <seastar/core/circular_buffer.hh>
+#include <seastar/core/condition-variable.hh>
 #include <seastar/core/io_priority_class.hh>
 #include <seastar/core/shared_ptr.hh>
 #include <seastar/core/sstring.hh>
@@ -171,6 +173,34 @@ struct throwing_kv : public simple_kv {
 
     bool _tried_applying = false;
 };
+/**
+ * Blocking stm does not apply anything until released.
+ */
+struct blocking_kv : public simple_kv {
+    explicit blocking_kv(raft_node_instance& rn)
+      : simple_kv(rn) {}
+
+    std::string_view get_name() const override { return "blocking_kv"; };
+
+    ss::future<> apply(const model::record_batch& batch) override {
+        co_await _released.wait([this] { return !_blocked; });
+        vassert(
+          batch.base_offset() == next(),
+          "batch {} base offset is not the next to apply, expected base "
+          "offset: {}",
+          batch.header(),
+          next());
+        co_await simple_kv::apply(batch);
+    }
+
+    void release() {
+        _blocked = false;
+        _released.broadcast();
+    }
+
+    bool _blocked = true;
+    ss::condition_variable _released;
+};
 /**
  * Local snapshot stm manages its own local snapshot.
  */
@@ -547,3 +577,48 @@ TEST_F_CORO(
 
     ASSERT_EQ_CORO(new_stm->state, partial_expected_state);
 }
+
+TEST_F_CORO(state_machine_manager_fixture, test_slow_stm_does_not_block_others) {
+    config::shard_local_cfg().stm_apply_timeout_ms.set_value(
+      std::chrono::milliseconds(50));
+    create_nodes();
+    std::vector<ss::shared_ptr<simple_kv>> kv_stms;
+    std::vector<ss::shared_ptr<blocking_kv>> blocking_stms;
+
+    for (auto& [id, node] : nodes()) {
+        raft::state_machine_manager_builder builder;
+        kv_stms.push_back(builder.create_stm<simple_kv>(*node));
+        blocking_stms.push_back(builder.create_stm<blocking_kv>(*node));
+        co_await node->start(all_vnodes(), std::move(builder));
+    }
+
+    auto expected = co_await build_random_state(1000);
+    auto committed_offset = co_await with_leader(
+      10s,
+      [](raft_node_instance& node) { return node.raft()->committed_offset(); });
+
+    // the other stm catches up while the blocking one did not apply anything
+    co_await ss::coroutine::parallel_for_each(
+      kv_stms, [committed_offset](ss::shared_ptr<simple_kv>& stm) {
+          return stm->wait(committed_offset, model::timeout_clock::now() + 20s);
+      });
+    bool blocked_behind = std::all_of(
+      blocking_stms.begin(),
+      blocking_stms.end(),
+      [committed_offset](const ss::shared_ptr<blocking_kv>& stm) {
+          return stm->last_applied_offset() < committed_offset;
+      });
+    for (auto& stm : blocking_stms) {
+        stm->release();
+    }
+    ASSERT_TRUE_CORO(blocked_behind);
+    for (auto& stm : kv_stms) {
+        ASSERT_EQ_CORO(stm->state, expected);
+    }
+
+    co_await wait_for_apply();
+    for (auto& stm : blocking_stms) {
+        ASSERT_EQ_CORO(stm->state, expected);
+    }
+    config::shard_local_cfg().stm_apply_timeout_ms.reset();
+}
@@ -94,6 +94,7 @@
 #include "ssx/future-util.h"
 #include "ssx/metrics.h"
 #include "ssx/sformat.h"
+#include "ssx/thread_worker.h"
 #include "utils/fragmented_vector.h"
 #include "utils/string_switch.h"
 #include "utils/utf8.h"
@@ -240,7 +241,8 @@ admin_server::admin_server(
   ss::sharded<storage::node>& storage_node,
   ss::sharded<memory_sampling>& memory_sampling_service,
   ss::sharded<cloud_storage::cache>& cloud_storage_cache,
-  ss::sharded<resources::cpu_profiler>& cpu_profiler)
+  ss::sharded<resources::cpu_profiler>& cpu_profiler,
+  ssx::singleton_thread_worker& thread_worker)
   : _log_level_timer([this] { log_level_timer_handler(); })
   , _server("admin")
   , _cfg(std::move(cfg))
@@ -267,6 +269,7 @@ admin_server::admin_server(
   , _memory_sampling_service(memory_sampling_service)
   , _cloud_storage_cache(cloud_storage_cache)
   , _cpu_profiler(cpu_profiler)
+  , _thread_worker(thread_worker)
   , _default_blocked_reactor_notify(
       ss::engine().get_blocked_reactor_notify_ms()) {
     _server.set_content_streaming(true);
@@ -1809,7 +1812,10 @@ void admin_server::register_raft_routes() {
 namespace {
 
 // TODO: factor out generic serialization from seastar http exceptions
-security::scram_credential parse_scram_credential(const json::Document& doc) {
+// Deriving the salted password takes thousands of HMAC iterations, it runs on
+// the thread worker rather than stalling the reactor.
+ss::future<security::scram_credential> parse_scram_credential(
+  ssx::singleton_thread_worker& worker, const json::Document& doc) {
     if (!doc.IsObject()) {
         throw ss::httpd::bad_request_exception(fmt::format("Not an object"));
     }
@@ -1826,41 +1832,47 @@ security::scram_credential parse_scram_credential(const json::Document& doc) {
         throw ss::httpd::bad_request_exception(
           fmt::format("String password smissing"));
     }
-    const auto password = doc["password"].GetString();
+    auto password = ss::sstring(doc["password"].GetString());
     validate_no_control(password, string_conversion_exception{"PASSWORD"});
 
-    security::scram_credential credential;
-
     if (algorithm == security::scram_sha256_authenticator::name) {
-        credential = security::scram_sha256::make_credentials(
-          password, security::scram_sha256::min_iterations);
-
+        co_return co_await worker.submit([password = std::move(password)] {
+            return security::scram_sha256::make_credentials(
+              password, security::scram_sha256::min_iterations);
+        });
     } else if (algorithm == security::scram_sha512_authenticator::name) {
-        credential = security::scram_sha512::make_credentials(
-          password, security::scram_sha512::min_iterations);
-
+        co_return co_await worker.submit([password = std::move(password)] {
+            return security::scram_sha512::make_credentials(
+              password, security::scram_sha512::min_iterations);
+        });
     } else {
         throw ss::httpd::bad_request_exception(
           fmt::format("Unknown scram algorithm: {}", algorithm));
     }
-
-    return credential;
 }
 
-bool match_scram_credential(
-  const json::Document& doc, const security::scram_credential& creds) {
+ss::future<bool> match_scram_credential(
+  ssx::singleton_thread_worker& worker,
+  const json::Document& doc,
+  security::scram_credential creds) {
     // Document is pre-validated via earlier parse_scram_credential call
-    const auto password = ss::sstring(doc["password"].GetString());
+    auto password = ss::sstring(doc["password"].GetString());
     const auto algorithm = std::string_view(
       doc["algorithm"].GetString(), doc["algorithm"].GetStringLength());
     validate_no_control(algorithm, string_conversion_exception{algorithm});
 
     if (algorithm == security::scram_sha256_authenticator::name) {
-        return security::scram_sha256::validate_password(
-          password, creds.stored_key(), creds.salt(), creds.iterations());
+        co_return co_await worker.submit(
+          [password = std::move(password), creds = std::move(creds)] {
+              return security::scram_sha256::validate_password(
+                password, creds.stored_key(), creds.salt(), creds.iterations());
+          });
     } else if (algorithm == security::scram_sha512_authenticator::name) {
-        return security::scram_sha512::validate_password(
-          password, creds.stored_key(), creds.salt(), creds.iterations());
+        co_return co_await worker.submit(
+          [password = std::move(password), creds = std::move(creds)] {
+              return security::scram_sha512::validate_password(
+                password, creds.stored_key(), creds.salt(), creds.iterations());
+          });
     } else {
         throw ss::httpd::bad_request_exception(
           fmt::format("Unknown scram algorithm: {}", algorithm));
@@ -1890,7 +1902,7 @@ admin_server::create_user_handler(std::unique_ptr<ss::http::request> req) {
 
     auto doc = co_await parse_json_body(req.get());
 
-    auto credential = parse_scram_credential(doc);
+    auto credential = co_await parse_scram_credential(_thread_worker, doc);
 
     if (!doc.HasMember("username") || !doc["username"].IsString()) {
         throw ss::httpd::bad_request_exception(
@@ -1922,7 +1934,10 @@ admin_server::create_user_handler(std::unique_ptr<ss::http::request> req) {
           = _controller->get_credential_store().local();
         std::optional<security::scram_credential> creds
           = credentials_store.get<security::scram_credential>(username);
-        if (creds.has_value() && match_scram_credential(doc, creds.value())) {
+        if (
+          creds.has_value()
+          && co_await match_scram_credential(
+            _thread_worker, doc, std::move(creds.value()))) {
             co_return ss::json::json_return_type(ss::json::json_void());
         }
     }
@@ -1970,7 +1985,7 @@ admin_server::update_user_handler(std::unique_ptr<ss::http::request> req) {
 
     auto doc = co_await parse_json_body(req.get());
 
-    auto credential = parse_scram_credential(doc);
+    auto credential = co_await parse_scram_credential(_thread_worker, doc);
 
     if (is_no_op_user_write(
           _controller->get_credential_store().local(), user, credential)) {
@@ -24,6 +24,7 @@
 #include "resource_mgmt/memory_sampling.h"
 #include "rpc/connection_cache.h"
 #include "seastarx.h"
+#include "ssx/fwd.h"
 #include "storage/node.h"
 #include "utils/request_auth.h"
 
@@ -84,7 +85,8 @@ public:
       ss::sharded<storage::node>&,
       ss::sharded<memory_sampling>&,
       ss::sharded<cloud_storage::cache>&,
-      ss::sharded<resources::cpu_profiler>&);
+      ss::sharded<resources::cpu_profiler>&,
+      ssx::singleton_thread_worker&);
 
     ss::future<> start();
     ss::future<> stop();
@@ -554,6 +556,7 @@ private:
     ss::sharded<memory_sampling>& _memory_sampling_service;
     ss::sharded<cloud_storage::cache>& _cloud_storage_cache;
     ss::sharded<resources::cpu_profiler>& _cpu_profiler;
+    ssx::singleton_thread_worker& _thread_worker;
 
     // Value before the temporary override
     std::chrono::milliseconds _default_blocked_reactor_notify;
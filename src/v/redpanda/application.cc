@@ -695,6 +695,7 @@ void application::hydrate_config(const po::variables_map& cfg) {
             _proxy_client_config.emplace(config["pandaproxy_client"]);
         } else {
             set_local_kafka_client_config(_proxy_client_config, config::node());
+            _proxy_client_is_local = true;
         }
         set_pp_kafka_client_defaults(*_proxy_config, *_proxy_client_config);
         config_printer("pandaproxy", *_proxy_config);
@@ -889,7 +890,8 @@ void application::configure_admin_server() {
       std::ref(storage_node),
       std::ref(_memory_sampling),
       std::ref(shadow_index_cache),
-      std::ref(_cpu_profiler))
+      std::ref(_cpu_profiler),
+      std::ref(*thread_worker))
       .get();
 }
 
@@ -1046,7 +1048,9 @@ void application::wire_up_runtime_services(
           memory_groups::kafka_total_memory(),
           *_proxy_client_config,
           *_proxy_config,
-          controller.get());
+          controller.get(),
+          _proxy_client_is_local,
+          &quota_mgr);
     }
     if (_schema_reg_config) {
         construct_single_service(
@@ -247,6 +247,8 @@ private:
 
     std::optional<pandaproxy::rest::configuration> _proxy_config;
     std::optional<kafka::client::configuration> _proxy_client_config;
+    // The proxy's kafka client talks to this node
+    bool _proxy_client_is_local{false};
     std::optional<pandaproxy::schema_registry::configuration>
       _schema_reg_config;
     std::optional<kafka::client::configuration> _schema_reg_client_config;
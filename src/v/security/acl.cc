@@ -19,6 +19,8 @@
 #include <absl/container/flat_hash_map.h>
 #include <fmt/format.h>
 
+#include <algorithm>
+
 namespace security {
 
 seastar::logger seclog("security");
@@ -48,6 +50,29 @@ std::optional<std::reference_wrapper<const acl_entry>> acl_entry_set::find(
     return std::nullopt;
 }
 
+bool acl_entry_set::contains_host_specific(
+  acl_operation operation,
+  const acl_principal& principal,
+  acl_permission perm) const {
+    for (const auto& entry : _entries) {
+        if (entry.permission() != perm) {
+            continue;
+        }
+        if (entry.principal() != principal && !entry.principal().wildcard()) {
+            continue;
+        }
+        if (
+          entry.operation() != operation
+          && entry.operation() != acl_operation::all) {
+            continue;
+        }
+        if (entry.host() != acl_wildcard_host) {
+            return true;
+        }
+    }
+    return false;
+}
+
 bool acl_matches::empty() const {
     if (wildcards && !wildcards->get().empty()) {
         return false;
@@ -87,6 +112,115 @@ bool acl_matches::contains(
     return false;
 }
 
+bool acl_matches::contains_host_specific(
+  acl_operation operation,
+  const acl_principal& principal,
+  acl_permission perm) const {
+    auto contains = [&](const acl_entry_set& entries) {
+        return entries.contains_host_specific(operation, principal, perm);
+    };
+    return std::any_of(
+             prefixes.begin(),
+             prefixes.end(),
+             [&](entry_set_ref entries) { return contains(entries.get()); })
+           || (wildcards && contains(wildcards->get()))
+           || (literals && contains(literals->get()));
+}
+
+void acl_prefix_trie::clear() {
+    _nodes.clear();
+    _roots.clear();
+}
+
+std::optional<uint32_t> acl_prefix_trie::root(resource_type resource) const {
+    for (const auto& [r, n] : _roots) {
+        if (r == resource) {
+            return n;
+        }
+    }
+    return std::nullopt;
+}
+
+std::optional<uint32_t> acl_prefix_trie::child(uint32_t n, char c) const {
+    const auto& children = _nodes[n].children;
+    auto it = std::lower_bound(
+      children.begin(),
+      children.end(),
+      c,
+      [](const std::pair<char, uint32_t>& lhs, char rhs) {
+          return lhs.first < rhs;
+      });
+    if (it == children.end() || it->first != c) {
+        return std::nullopt;
+    }
+    return it->second;
+}
+
+void acl_prefix_trie::insert(
+  resource_type resource,
+  std::string_view prefix,
+  const acl_entry_set& entries) {
+    // an empty prefix never matched a resource name
+    if (prefix.empty()) {
+        return;
+    }
+    auto n = root(resource);
+    if (!n) {
+        n = _nodes.size();
+        _nodes.emplace_back();
+        _roots.emplace_back(resource, *n);
+    }
+    for (auto c : prefix) {
+        auto next = child(*n, c);
+        if (!next) {
+            next = _nodes.size();
+            _nodes.emplace_back();
+            auto& children = _nodes[*n].children;
+            children.insert(
+              std::upper_bound(
+                children.begin(),
+                children.end(),
+                c,
+                [](char lhs, const std::pair<char, uint32_t>& rhs) {
+                    return lhs < rhs.first;
+                }),
+              {c, *next});
+        }
+        n = next;
+    }
+    _nodes[*n].entries = &entries;
+}
+
+void acl_prefix_trie::find(
+  resource_type resource,
+  std::string_view name,
+  std::vector<acl_matches::entry_set_ref>& out) const {
+    auto n = root(resource);
+    for (auto c : name) {
+        if (!n) {
+            break;
+        }
+        n = child(*n, c);
+        if (n && _nodes[*n].entries) {
+            out.emplace_back(*_nodes[*n].entries);
+        }
+    }
+}
+
+const acl_prefix_trie& acl_store::prefixes() const {
+    if (_prefixes_generation == _generation) {
+        return _prefixes;
+    }
+    _prefixes.clear();
+    for (const auto& [pattern, entries] : _acls) {
+        if (pattern.pattern() == pattern_type::prefixed && !entries.empty()) {
+            _prefixes.insert(pattern.resource(), pattern.name(), entries);
+        }
+    }
+    _prefixes_generation = _generation;
+    return _prefixes;
+}
+
 acl_matches
 acl_store::find(resource_type resource, const ss::sstring& name) const {
     using opt_entry_set = std::optional<acl_matches::entry_set_ref>;
@@ -107,24 +241,8 @@ acl_store::find(resource_type resource, const ss::sstring& name) const {
         literals = it->second;
     }
 
-    /*
-     * the acls are sorted within (resource-type, pattern-type) bounds by name
-     * in reverse order so longer names (prefixes) appear first.
-     */
     std::vector<acl_matches::entry_set_ref> prefixes;
-    {
-        auto it = _acls.lower_bound(
-          resource_pattern(resource, name, pattern_type::prefixed));
-
-        auto end = _acls.upper_bound(resource_pattern(
-          resource, name.substr(0, 1), pattern_type::prefixed));
-
-        for (; it != end; ++it) {
-            if (std::string_view(name).starts_with(it->first.name())) {
-                prefixes.emplace_back(it->second);
-            }
-        }
-    }
+    this->prefixes().find(resource, name, prefixes);
 
     return acl_matches(wildcards, literals, std::move(prefixes));
 }
@@ -194,6 +312,10 @@ std::vector<std::vector<acl_binding>> acl_store::remove_bindings(
           });
     }
 
+    if (!dry_run && !deleted.empty()) {
+        ++_generation;
+    }
+
     std::vector<std::vector<acl_binding>> res;
     res.assign(filters.size(), {});
 
@@ -233,10 +355,12 @@ ss::future<>
 acl_store::reset_bindings(const fragmented_vector<acl_binding>& bindings) {
     // NOTE: not coroutinized because otherwise clang-14 crashes.
     _acls.clear();
+    ++_generation;
     return ss::do_for_each(
              bindings,
              [this](const auto& binding) {
                  _acls[binding.pattern()].insert(binding.entry());
+                 ++_generation;
              })
       .then([this] {
           return ss::do_for_each(_acls, [](auto& kv) { kv.second.rehash(); });
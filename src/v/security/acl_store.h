@@ -58,6 +58,13 @@ public:
         return find(operation, principal, host, perm).has_value();
     }
 
+    // whether an entry for the operation and principal names a specific
+    // host, i.e. whether it matches some client hosts but not others
+    bool contains_host_specific(
+      acl_operation operation,
+      const acl_principal& principal,
+      acl_permission perm) const;
+
     const_iterator begin() const { return _entries.cbegin(); }
     const_iterator end() const { return _entries.cend(); }
 
@@ -97,12 +104,50 @@ public:
       const acl_host& host,
       acl_permission perm) const;
 
+    bool contains_host_specific(
+      acl_operation operation,
+      const acl_principal& principal,
+      acl_permission perm) const;
+
 private:
     std::optional<entry_set_ref> wildcards;
     std::optional<entry_set_ref> literals;
     std::vector<entry_set_ref> prefixes;
 };
 
+/*
+ * A trie of prefixed resource patterns, per resource type. Finding the
+ * patterns that are a prefix of a resource name walks the name once, rather
+ * than visiting every pattern that sorts between the name and its first
+ * character.
+ *
+ * The trie refers to entry sets owned by the acl_store, so it has to be
+ * rebuilt whenever the store changes.
+ */
+class acl_prefix_trie {
+public:
+    void clear();
+    void insert(
+      resource_type resource, std::string_view prefix, const acl_entry_set&);
+    void find(
+      resource_type resource,
+      std::string_view name,
+      std::vector<acl_matches::entry_set_ref>& out) const;
+
+private:
+    struct node {
+        // sorted by character
+        std::vector<std::pair<char, uint32_t>> children;
+        const acl_entry_set* entries{nullptr};
+    };
+
+    std::optional<uint32_t> root(resource_type) const;
+    std::optional<uint32_t> child(uint32_t n, char c) const;
+
+    std::vector<node> _nodes;
+    std::vector<std::pair<resource_type, uint32_t>> _roots;
+};
+
 /*
  * Container for ACLs.
  */
@@ -121,6 +166,7 @@ public:
             entries.insert(binding.entry());
             entries.rehash();
         }
+        ++_generation;
     }
 
     // remove bindings according the input filters and return the bindings that
@@ -137,7 +183,12 @@ public:
     ss::future<fragmented_vector<acl_binding>> all_bindings() const;
     ss::future<> reset_bindings(const fragmented_vector<acl_binding>& bindings);
 
+    // Advanced on every change to the set of ACLs.
+    uint64_t generation() const { return _generation; }
+
 private:
+    const acl_prefix_trie& prefixes() const;
+
     /*
      * resource pattern ordering:
      *
@@ -160,6 +211,11 @@ private:
 
     absl::btree_map<resource_pattern, acl_entry_set, resource_pattern_compare>
       _acls;
+    uint64_t _generation{0};
+
+    // Built on demand from _acls, valid while _prefixes_generation matches.
+    mutable acl_prefix_trie _prefixes;
+    mutable std::optional<uint64_t> _prefixes_generation;
 };
 
 } // namespace security
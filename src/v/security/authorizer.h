@@ -21,9 +21,12 @@
 #include <seastar/core/sstring.hh>
 #include <seastar/util/bool_class.hh>
 
+#include <absl/container/flat_hash_map.h>
 #include <absl/container/flat_hash_set.h>
 #include <fmt/core.h>
 
+#include <string_view>
+
 namespace security {
 
 /*
@@ -36,6 +39,13 @@ namespace security {
  * perform any operation. When authorization occurs if the assocaited principal
  * is found in the set of superusers then its request will be permitted. If the
  * principal is not a superuser then normal ACL authorization applies.
+ *
+ * decision cache
+ * ==============
+ *
+ * Authorization runs for every resource of a request, e.g. every topic in a
+ * produce or fetch, while ACLs rarely change. The decisions made are cached
+ * per principal, host, resource and operation until the ACL store changes.
  */
 class authorizer final {
 public:
@@ -95,23 +105,46 @@ public:
       const acl_principal& principal,
       const acl_host& host) const {
         auto type = get_resource_type<T>();
-        auto acls = _store.find(type, resource_name());
 
         if (_superusers.contains(principal)) {
             return true;
         }
 
-        if (acls.empty()) {
-            return bool(_allow_empty_matches);
+        if (_decisions_generation != _store.generation()) {
+            _decisions.clear();
+            _decisions_generation = _store.generation();
+        }
+        const decision_key_view key{
+          principal, host, type, resource_name(), operation};
+        if (auto it = _decisions.find(key); it != _decisions.end()) {
+            return it->second;
         }
 
-        // check for deny
-        if (acls.contains(operation, principal, host, acl_permission::deny)) {
-            return false;
+        auto allowed = authorize_uncached(
+          type, resource_name(), operation, principal, host);
+        if (_decisions.size() >= decision_cache_capacity) {
+            _decisions.clear();
         }
+        _decisions.emplace(decision_key(key), allowed);
+        return allowed;
+    }
 
-        // check for allow
-        return acl_any_implied_ops_allowed(acls, principal, host, operation);
+    /*
+     * Whether a deny ACL that names a specific host applies to an operation.
+     * A decision made for the wildcard host doesn't hold for every client
+     * host when there is one.
+     */
+    template<typename T>
+    bool host_specific_deny(
+      const T& resource_name,
+      acl_operation operation,
+      const acl_principal& principal) const {
+        if (_superusers.contains(principal)) {
+            return false;
+        }
+        auto acls = _store.find(get_resource_type<T>(), resource_name());
+        return acls.contains_host_specific(
+          operation, principal, acl_permission::deny);
     }
 
     ss::future<fragmented_vector<acl_binding>> all_bindings() const {
@@ -124,6 +157,27 @@ public:
     }
 
 private:
+    bool authorize_uncached(
+      resource_type type,
+      const ss::sstring& resource_name,
+      acl_operation operation,
+      const acl_principal& principal,
+      const acl_host& host) const {
+        auto acls = _store.find(type, resource_name);
+
+        if (acls.empty()) {
+            return bool(_allow_empty_matches);
+        }
+
+        // check for deny
+        if (acls.contains(operation, principal, host, acl_permission::deny)) {
+            return false;
+        }
+
+        // check for allow
+        return acl_any_implied_ops_allowed(acls, principal, host, operation);
+    }
+
     /*
      * Compute whether the specified operation is allowed based on the implied
      * operations.
@@ -162,6 +216,84 @@ private:
     }
     acl_store _store;
 
+    /*
+     * The decision cache. Lookups are made by a view of the request so that
+     * hits don't copy the principal and resource names.
+     */
+    struct decision_key_view {
+        const acl_principal& principal;
+        const acl_host& host;
+        resource_type resource;
+        std::string_view name;
+        acl_operation operation;
+
+        template<typename H>
+        friend H AbslHashValue(H h, const decision_key_view& k) {
+            return H::combine(
+              std::move(h),
+              k.principal,
+              k.host,
+              k.resource,
+              k.name,
+              k.operation);
+        }
+    };
+
+    struct decision_key {
+        explicit decision_key(const decision_key_view& v)
+          : principal(v.principal)
+          , host(v.host)
+          , resource(v.resource)
+          , name(v.name)
+          , operation(v.operation) {}
+
+        decision_key_view view() const {
+            return {principal, host, resource, name, operation};
+        }
+
+        acl_principal principal;
+        acl_host host;
+        resource_type resource;
+        ss::sstring name;
+        acl_operation operation;
+    };
+
+    struct decision_hash {
+        using is_transparent = void;
+        size_t operator()(const decision_key_view& k) const {
+            return absl::Hash<decision_key_view>{}(k);
+        }
+        size_t operator()(const decision_key& k) const {
+            return (*this)(k.view());
+        }
+    };
+
+    struct decision_eq {
+        using is_transparent = void;
+        static bool eq(const decision_key_view& a, const decision_key_view& b) {
+            return a.principal == b.principal && a.host == b.host
+                   && a.resource == b.resource && a.name == b.name
+                   && a.operation == b.operation;
+        }
+        template<typename L, typename R>
+        bool operator()(const L& a, const R& b) const {
+            return eq(view(a), view(b));
+        }
+
+    private:
+        static decision_key_view view(const decision_key_view& k) { return k; }
+        static decision_key_view view(const decision_key& k) {
+            return k.view();
+        }
+    };
+
+    // The cache is cleared when it fills up, rather than tracking recency on
+    // every lookup.
+    static constexpr size_t decision_cache_capacity = 16384;
+    mutable absl::flat_hash_map<decision_key, bool, decision_hash, decision_eq>
+      _decisions;
+    mutable uint64_t _decisions_generation{0};
+
     // The list of superusers is stored twice: once as a vector in the
     // configuration subsystem, then again has a set here for fast lookups.
     // The set is updated on changes via the config::binding.
@@ -0,0 +1,108 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#pragma once
+#include "bytes/bytes.h"
+#include "hashing/secure.h"
+#include "random/generators.h"
+#include "security/scram_credential.h"
+#include "security/types.h"
+
+#include <seastar/core/sstring.hh>
+
+#include <absl/container/flat_hash_map.h>
+#include <gnutls/gnutls.h>
+
+#include <array>
+#include <optional>
+
+namespace security {
+
+/*
+ * Remembers passwords that were verified against stored SCRAM credentials.
+ *
+ * Verifying a password outside of a SCRAM exchange, e.g. for HTTP basic auth,
+ * derives the salted password with thousands of HMAC iterations. Clients
+ * present the same password on every request, so once verified a keyed digest
+ * of the password is kept per user, and later requests are verified with a
+ * single HMAC. An entry only applies while the user's stored credential is
+ * unchanged. Plain passwords are never kept.
+ */
+class scram_password_cache {
+public:
+    explicit scram_password_cache(size_t capacity)
+      : _key(random_generators::get_bytes(key_size))
+      , _capacity(capacity) {}
+
+    /*
+     * The SASL mechanism \p password was verified with for \p user, if it was
+     * verified against the current credential before.
+     */
+    std::optional<ss::sstring> find(
+      const credential_user& user,
+      const credential_password& password,
+      const scram_credential& credential) const {
+        auto it = _entries.find(user);
+        if (
+          it == _entries.end()
+          || it->second.stored_key != credential.stored_key()) {
+            return std::nullopt;
+        }
+        // constant time, so that response times don't hint at the digest
+        const auto d = digest(password, credential);
+        if (
+          gnutls_memcmp(it->second.password.data(), d.data(), d.size())
+          != 0) {
+            return std::nullopt;
+        }
+        return it->second.mechanism;
+    }
+
+    void insert(
+      const credential_user& user,
+      const credential_password& password,
+      const scram_credential& credential,
+      ss::sstring mechanism) {
+        if (_entries.size() >= _capacity && !_entries.contains(user)) {
+            _entries.clear();
+        }
+        _entries.insert_or_assign(
+          user,
+          entry{
+            .stored_key = credential.stored_key(),
+            .password = digest(password, credential),
+            .mechanism = std::move(mechanism)});
+    }
+
+private:
+    static constexpr size_t key_size = 32;
+    using digest_t = std::array<char, 32>;
+
+    digest_t digest(
+      const credential_password& password,
+      const scram_credential& credential) const {
+        hmac_sha256 mac(_key);
+        mac.update(credential.salt());
+        mac.update(password());
+        return mac.reset();
+    }
+
+    struct entry {
+        bytes stored_key;
+        digest_t password;
+        ss::sstring mechanism;
+    };
+
+    bytes _key;
+    size_t _capacity;
+    absl::flat_hash_map<credential_user, entry> _entries;
+};
+
+} // namespace security
@@ -898,4 +898,64 @@ BOOST_AUTO_TEST_CASE(topic_group_same_name) {
       kafka::group_id("topic-foo-xxx"), acl_operation::read, user, host));
 }
 
+// decisions are cached, and must follow changes to the acls
+BOOST_AUTO_TEST_CASE(cached_decisions_follow_acl_changes) {
+    auto auth = make_test_instance();
+
+    acl_principal user(principal_type::user, "alice");
+    acl_host host("192.168.0.1");
+    const model::topic topic("foo-bar-baz");
+
+    BOOST_REQUIRE(!auth.authorized(topic, acl_operation::read, user, host));
+
+    // nested prefixes
+    std::vector<acl_binding> bindings;
+    bindings.emplace_back(
+      resource_pattern(resource_type::topic, "foo-", pattern_type::prefixed),
+      allow_read_acl);
+    bindings.emplace_back(
+      resource_pattern(resource_type::topic, "foo-bar", pattern_type::prefixed),
+      allow_write_acl);
+    auth.add_bindings(bindings);
+
+    BOOST_REQUIRE(auth.authorized(topic, acl_operation::read, user, host));
+    BOOST_REQUIRE(auth.authorized(topic, acl_operation::write, user, host));
+    BOOST_REQUIRE(auth.authorized(
+      model::topic("foo-baz"), acl_operation::read, user, host));
+    BOOST_REQUIRE(!auth.authorized(
+      model::topic("foo-baz"), acl_operation::write, user, host));
+
+    bindings.clear();
+    bindings.emplace_back(
+      resource_pattern(
+        resource_type::topic, "foo-bar-", pattern_type::prefixed),
+      deny_read_acl);
+    auth.add_bindings(bindings);
+
+    BOOST_REQUIRE(!auth.authorized(topic, acl_operation::read, user, host));
+    BOOST_REQUIRE(auth.authorized(topic, acl_operation::write, user, host));
+
+    auto removed = auth.remove_bindings(
+      {acl_binding_filter(
+        resource_pattern_filter(resource_pattern(
+          resource_type::topic, "foo-bar-", pattern_type::prefixed)),
+        acl_entry_filter::any())});
+    BOOST_REQUIRE_EQUAL(removed.size(), 1);
+    BOOST_REQUIRE_EQUAL(removed[0].size(), 1);
+
+    BOOST_REQUIRE(auth.authorized(topic, acl_operation::read, user, host));
+
+    // a dry run leaves the acls, and the decisions, in place
+    auth.remove_bindings(
+      {acl_binding_filter(
+        resource_pattern_filter::any(), acl_entry_filter::any())},
+      true);
+    BOOST_REQUIRE(auth.authorized(topic, acl_operation::read, user, host));
+
+    auth.remove_bindings({acl_binding_filter(
+      resource_pattern_filter::any(), acl_entry_filter::any())});
+    BOOST_REQUIRE(!auth.authorized(topic, acl_operation::read, user, host));
+    BOOST_REQUIRE(!auth.authorized(topic, acl_operation::write, user, host));
+}
+
 } // namespace security
@@ -9,6 +9,7 @@
 #define BOOST_TEST_MODULE kafka_security
 #include "random/generators.h"
 #include "security/scram_algorithm.h"
+#include "security/scram_password_cache.h"
 #include "utils/base64.h"
 
 #include <seastar/testing/thread_test_case.hh>
@@ -304,4 +305,31 @@ BOOST_AUTO_TEST_CASE(validate_password) {
     BOOST_REQUIRE_EQUAL(check_garbage, false);
 }
 
+BOOST_AUTO_TEST_CASE(password_cache) {
+    credential_user user{"alice"};
+    credential_password password{"letmein"};
+    credential_password garbage{"letmeout"};
+    int iterations = 3;
+
+    auto creds = scram_sha256::make_credentials(password, iterations);
+
+    scram_password_cache cache(1);
+    BOOST_REQUIRE(!cache.find(user, password, creds).has_value());
+
+    cache.insert(user, password, creds, "SCRAM-SHA-256");
+    BOOST_REQUIRE_EQUAL(
+      cache.find(user, password, creds).value_or(""), "SCRAM-SHA-256");
+    BOOST_REQUIRE(!cache.find(user, garbage, creds).has_value());
+
+    // A new credential for the same password is verified again
+    auto new_creds = scram_sha256::make_credentials(password, iterations);
+    BOOST_REQUIRE(!cache.find(user, password, new_creds).has_value());
+
+    // Capacity is bounded
+    credential_user bob{"bob"};
+    cache.insert(bob, password, creds, "SCRAM-SHA-256");
+    BOOST_REQUIRE(cache.find(bob, password, creds).has_value());
+    BOOST_REQUIRE(!cache.find(user, password, creds).has_value());
+}
+
 } // namespace security
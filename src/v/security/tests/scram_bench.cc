@@ -0,0 +1,103 @@
+// Copyright 2023 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "random/generators.h"
+#include "security/credential_store.h"
+#include "security/scram_algorithm.h"
+#include "security/scram_authenticator.h"
+#include "security/scram_password_cache.h"
+#include "vassert.h"
+
+#include <seastar/testing/perf_tests.hh>
+
+namespace {
+
+using scram = security::scram_sha256;
+
+const security::credential_user user{"bench"};
+const security::credential_password password{"letmein"};
+
+// A client that completes a SCRAM exchange against a server authenticator.
+// The client's key derivation is done upfront so that only the exchange is
+// measured.
+ss::future<> scram_handshake(
+  security::credential_store& store, const bytes& salted_password) {
+    security::scram_sha256_authenticator::auth auth(store);
+
+    security::client_first_message client_first(
+      user(), random_generators::gen_alphanum_string(32));
+    auto first = client_first.message();
+    auto server_first_msg = co_await auth.authenticate(
+      bytes(first.begin(), first.end()));
+    vassert(server_first_msg.has_value(), "client first rejected");
+
+    security::server_first_message server_first(server_first_msg.value());
+    constexpr std::string_view gs2_header{"n,,"};
+    security::client_final_message client_final(
+      bytes(gs2_header.begin(), gs2_header.end()), server_first.nonce());
+    client_final.set_proof(scram::client_proof(
+      salted_password, client_first, server_first, client_final));
+
+    auto final = client_final.message();
+    auto server_final = co_await auth.authenticate(
+      bytes(final.begin(), final.end()));
+    vassert(server_final.has_value() && auth.complete(), "proof rejected");
+}
+
+ss::future<> run_handshakes(size_t count) {
+    security::credential_store store;
+    auto creds = scram::make_credentials(password, scram::min_iterations);
+    auto salted_password = scram::hi(
+      bytes(password().begin(), password().end()),
+      creds.salt(),
+      creds.iterations());
+    store.put(user, std::move(creds));
+
+    perf_tests::start_measuring_time();
+    for (size_t i = 0; i < count; ++i) {
+        co_await scram_handshake(store, salted_password);
+    }
+    perf_tests::stop_measuring_time();
+}
+
+// Verifying a password as done for HTTP basic auth
+void run_validate_password(size_t count, bool cached) {
+    auto creds = scram::make_credentials(password, scram::min_iterations);
+    security::scram_password_cache cache(1);
+
+    perf_tests::start_measuring_time();
+    for (size_t i = 0; i < count; ++i) {
+        bool valid = cached && cache.find(user, password, creds).has_value();
+        if (!valid) {
+            valid = scram::validate_password(
+              password, creds.stored_key(), creds.salt(), creds.iterations());
+            cache.insert(user, password, creds, "SCRAM-SHA-256");
+        }
+        perf_tests::do_not_optimize(valid);
+    }
+    perf_tests::stop_measuring_time();
+}
+
+} // namespace
+
+struct scram_bench {};
+
+PERF_TEST_C(scram_bench, handshake_100) {
+    co_return co_await run_handshakes(100);
+}
+
+PERF_TEST_C(scram_bench, validate_password_100) {
+    run_validate_password(100, false);
+    co_return;
+}
+
+PERF_TEST_C(scram_bench, validate_password_cached_100) {
+    run_validate_password(100, true);
+    co_return;
+}
@@ -0,0 +1,227 @@
+/*
+ * Copyright 2023 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "seastarx.h"
+#include "ssx/future-util.h"
+
+#include <seastar/core/future.hh>
+#include <seastar/core/gate.hh>
+#include <seastar/core/scheduling.hh>
+#include <seastar/core/sharded.hh>
+#include <seastar/core/smp.hh>
+#include <seastar/util/later.hh>
+#include <seastar/util/noncopyable_function.hh>
+
+#include <algorithm>
+#include <exception>
+#include <memory>
+#include <vector>
+
+namespace ssx {
+
+/**
+ * Coalesces cross core work. Rather than sending one smp message per call,
+ * work bound for a shard is queued and sent in a single message once the
+ * current task queue drains, together with whatever concurrent fibers have
+ * queued for the same shard in the meantime. Results travel back the same
+ * way, batched by the dispatcher instance on the destination shard.
+ *
+ * Work is queued per scheduling group so that it runs on the destination
+ * shard in the group of the caller, as it would with ss::smp::submit_to.
+ *
+ * The dispatcher lives inside a peering sharded service which exposes it as
+ * `smp_dispatcher<Service>& dispatcher()`, so that the instance on the
+ * destination shard can be reached.
+ */
+template<typename Service>
+class smp_dispatcher {
+public:
+    using task = ss::noncopyable_function<void()>;
+
+    smp_dispatcher(Service& owner, ss::smp_service_group ssg)
+      : _owner(owner)
+      , _ssg(ssg)
+      , _pending(ss::smp::count) {}
+
+    smp_dispatcher(const smp_dispatcher&) = delete;
+    smp_dispatcher& operator=(const smp_dispatcher&) = delete;
+    smp_dispatcher(smp_dispatcher&&) = delete;
+    smp_dispatcher& operator=(smp_dispatcher&&) = delete;
+    ~smp_dispatcher() = default;
+
+    /**
+     * Runs \p func on \p shard and returns its result, with the semantics of
+     * ss::smp::submit_to. Work for the local shard runs inline.
+     */
+    template<typename Func>
+    auto submit_to(ss::shard_id shard, Func func) {
+        using futurator = ss::futurize<std::invoke_result_t<Func>>;
+        using promise_type = typename futurator::promise_type;
+        if (shard == ss::this_shard_id()) {
+            return futurator::invoke(std::move(func));
+        }
+        auto pr = std::make_unique<promise_type>();
+        auto f = pr->get_future();
+        post(
+          shard,
+          [&peers = _owner.container(),
+           home = ss::this_shard_id(),
+           func = std::move(func),
+           pr = std::move(pr)]() mutable {
+              auto& d = peers.local().dispatcher();
+              try {
+                  d.run_remote(home, std::move(func), pr);
+              } catch (...) {
+                  // the promise is only released once a reply owns it, so
+                  // a failure before that still resolves the caller
+                  if (pr) {
+                      d.post(
+                        home,
+                        make_error_reply(
+                          std::move(pr), std::current_exception()));
+                  }
+              }
+          });
+        return f;
+    }
+
+    /**
+     * Runs \p t on \p shard without waiting for it. Tasks posted to the same
+     * shard from the same scheduling group run in order.
+     */
+    void post(ss::shard_id shard, task t) {
+        if (shard == ss::this_shard_id()) {
+            t();
+            return;
+        }
+        if (_gate.is_closed()) {
+            background = ss::smp::submit_to(
+              shard, ss::smp_submit_to_options(_ssg), std::move(t));
+            return;
+        }
+        const auto sg = ss::current_scheduling_group();
+        auto& q = queue_for(shard, sg);
+        q.tasks.push_back(std::move(t));
+        if (q.tasks.size() == 1) {
+            spawn_with_gate(_gate, [this, shard, sg] {
+                return ss::yield().then(
+                  [this, shard, sg] { return flush(shard, sg); });
+            });
+        }
+    }
+
+    /**
+     * Sends out everything still queued. Work posted afterwards is sent
+     * right away, one message per call.
+     */
+    ss::future<> stop() { return _gate.close(); }
+
+private:
+    struct queue {
+        ss::scheduling_group sg;
+        std::vector<task> tasks;
+    };
+
+    queue& queue_for(ss::shard_id shard, ss::scheduling_group sg) {
+        auto& queues = _pending[shard];
+        auto it = std::find_if(
+          queues.begin(), queues.end(), [sg](const queue& q) {
+              return q.sg == sg;
+          });
+        if (it == queues.end()) {
+            return queues.emplace_back(queue{.sg = sg});
+        }
+        return *it;
+    }
+
+    ss::future<> flush(ss::shard_id shard, ss::scheduling_group sg) {
+        auto tasks = std::exchange(queue_for(shard, sg).tasks, {});
+        return ss::smp::submit_to(
+          shard,
+          ss::smp_submit_to_options(_ssg),
+          [tasks = std::move(tasks)]() mutable {
+              // a throwing task must not take the rest of the batch, and
+              // the promises they resolve, down with it
+              std::exception_ptr first;
+              for (auto& t : tasks) {
+                  try {
+                      t();
+                  } catch (...) {
+                      if (!first) {
+                          first = std::current_exception();
+                      }
+                  }
+              }
+              if (first) {
+                  std::rethrow_exception(first);
+              }
+          });
+    }
+
+    /// Runs on the destination shard and queues the result back to \p home.
+    template<typename Func, typename Promise>
+    void
+    run_remote(ss::shard_id home, Func func, std::unique_ptr<Promise>& pr) {
+        using futurator = ss::futurize<std::invoke_result_t<Func>>;
+        if (_gate.is_closed()) {
+            post(
+              home,
+              make_reply(
+                std::move(pr),
+                futurator::make_exception_future(ss::gate_closed_exception())));
+            return;
+        }
+        background = ss::with_gate(
+          _gate,
+          [this, home, func = std::move(func), pr = std::move(pr)]() mutable {
+              return futurator::invoke(std::move(func))
+                .then_wrapped([this, home, pr = std::move(pr)](
+                                typename futurator::type f) mutable {
+                    post(home, make_reply(std::move(pr), std::move(f)));
+                });
+          });
+    }
+
+    /// The reply owns the promise, which is only ever touched on its home
+    /// shard; the result is extracted here so that no future crosses shards.
+    template<typename Promise, typename Future>
+    static task make_reply(std::unique_ptr<Promise> pr, Future f) {
+        if (f.failed()) {
+            return make_error_reply(std::move(pr), f.get_exception());
+        }
+        using value_type = std::remove_cvref_t<decltype(f.get())>;
+        if constexpr (std::is_void_v<value_type>) {
+            f.get();
+            return [pr = std::move(pr)]() mutable { pr->set_value(); };
+        } else {
+            return [pr = std::move(pr), v = f.get()]() mutable {
+                pr->set_value(std::move(v));
+            };
+        }
+    }
+
+    template<typename Promise>
+    static task
+    make_error_reply(std::unique_ptr<Promise> pr, std::exception_ptr e) {
+        return [pr = std::move(pr), e = std::move(e)]() mutable {
+            pr->set_exception(std::move(e));
+        };
+    }
+
+    Service& _owner;
+    ss::smp_service_group _ssg;
+    std::vector<std::vector<queue>> _pending;
+    ss::gate _gate;
+};
+
+} // namespace ssx
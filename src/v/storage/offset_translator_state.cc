@@ -16,23 +16,78 @@
 #include "vassert.h"
 #include "vlog.h"
 
+#include <algorithm>
 #include <iterator>
 
 namespace storage {
 
+size_t offset_translator_state::lower_bound(model::offset o) const {
+    return std::lower_bound(
+             _last_offsets.begin() + _head, _last_offsets.end(), o)
+           - _last_offsets.begin();
+}
+
+size_t offset_translator_state::upper_bound(model::offset o) const {
+    return std::upper_bound(
+             _last_offsets.begin() + _head, _last_offsets.end(), o)
+           - _last_offsets.begin();
+}
+
+void offset_translator_state::push_back(
+  model::offset last_offset, model::offset base_offset, int64_t delta) {
+    _last_offsets.push_back(last_offset);
+    _base_offsets.push_back(base_offset);
+    _next_deltas.push_back(delta);
+}
+
+void offset_translator_state::erase_from(size_t i) {
+    if (i <= _head) {
+        reset();
+        return;
+    }
+    auto n = end_index() - i;
+    _last_offsets.pop_back_n(n);
+    _base_offsets.pop_back_n(n);
+    _next_deltas.pop_back_n(n);
+}
+
+namespace {
+template<typename Column>
+void drop_front(Column& c, size_t n) {
+    Column rest;
+    for (auto i = n; i < c.size(); ++i) {
+        rest.push_back(c[i]);
+    }
+    c = std::move(rest);
+}
+} // namespace
+
+void offset_translator_state::erase_to(size_t i) {
+    _head = i;
+    // prefix truncated entries are dropped in bulk, which keeps prefix
+    // truncation amortized O(1) per entry
+    if (_head * 2 < _last_offsets.size()) {
+        return;
+    }
+    drop_front(_last_offsets, _head);
+    drop_front(_base_offsets, _head);
+    drop_front(_next_deltas, _head);
+    _head = 0;
+}
+
 int64_t offset_translator_state::delta(model::offset o) const {
-    if (_last_offset2batch.empty()) {
+    if (empty()) {
         return 0;
     }
 
-    auto it = _last_offset2batch.lower_bound(o);
-    if (it == _last_offset2batch.begin()) {
+    auto i = lower_bound(o);
+    if (i == begin_index()) {
         // We don't have enough information to calculate delta if we've ended up
-        // here (even if we have an entry with the key o in the
-        // _last_offset2batch map). The reason is that the first entry of the
-        // map doesn't represent a real non-data batch, but rather an
-        // amalgamation of all non-data batches prior to the start of the
-        // translation range that is needed to save the delta at the log start.
+        // here (even if we have an entry with the last offset o). The reason
+        // is that the first entry of the map doesn't represent a real
+        // non-data batch, but rather an amalgamation of all non-data batches
+        // prior to the start of the translation range that is needed to save
+        // the delta at the log start.
         //
         // One common way to get this error is when the client code tries to
         // translate the end offset of an empty log (which is by convention
@@ -46,16 +101,15 @@ int64_t offset_translator_state::delta(model::offset o) const {
           "{})",
           _ntp,
           o,
-          model::next_offset(_last_offset2batch.begin()->first))};
+          model::next_offset(first_last_offset()))};
     }
 
-    auto delta = std::prev(it)->second.next_delta;
-    if (it == _last_offset2batch.end() || o < it->second.base_offset) {
+    auto delta = _next_deltas[i - 1];
+    if (i == end_index() || o < _base_offsets[i]) {
         // This is the common case: offset o is the offset of a record in a data
-        // batch between non-data batches pointed to by iterators `it` and
-        // `std::prev(it)` (or, if `it` is the map end, o is beyond the last
-        // non-data batch in the log). Delta that we need is stored in the map
-        // element pointed to by `std::prev(it)`.
+        // batch between non-data batches at indices `i` and `i - 1` (or, if
+        // `i` is the end, o is beyond the last non-data batch in the log).
+        // Delta that we need is stored in the entry at `i - 1`.
         return delta;
     } else {
         // The offset is inside the non-data batch, so the data offset stops
@@ -65,7 +119,7 @@ int64_t offset_translator_state::delta(model::offset o) const {
         // (redpanda) offset 0 is a config batch. Then its data (kafka) offset
         // must be 0, the same as the data (kafka) offset of the data record at
         // log (redpanda) offset 1.
-        return delta + (o - it->second.base_offset);
+        return delta + (o - _base_offsets[i]);
     }
 }
 model::offset_delta
@@ -80,7 +134,7 @@ model::offset offset_translator_state::from_log_offset(model::offset o) const {
 
 model::offset offset_translator_state::to_log_offset(
   model::offset data_offset, model::offset hint) const {
-    if (_last_offset2batch.empty()) {
+    if (empty()) {
         return data_offset;
     }
 
@@ -88,12 +142,10 @@ model::offset offset_translator_state::to_log_offset(
         return data_offset;
     }
 
-    model::offset min_log_offset = model::next_offset(
-      _last_offset2batch.begin()->first);
+    model::offset min_log_offset = model::next_offset(first_last_offset());
 
-    model::offset min_data_offset
-      = min_log_offset
-        - model::offset(_last_offset2batch.begin()->second.next_delta);
+    model::offset min_data_offset = min_log_offset
+                                    - model::offset(_next_deltas[_head]);
     if (data_offset < min_data_offset) {
         throw std::runtime_error{fmt::format(
           "ntp {}: data offset {} is outside the translation range (starting "
@@ -111,54 +163,46 @@ model::offset offset_translator_state::to_log_offset(
     // log offset equal to `data_offset` (because log offset is at least as
     // big as data offset) and stopping when we find the interval where
     // given data offset is achievable.
-    auto interval_end_it = _last_offset2batch.lower_bound(search_start);
+    auto interval_end = lower_bound(search_start);
     vassert(
-      interval_end_it != _last_offset2batch.begin(),
+      interval_end != begin_index(),
       "ntp {}: log offset search start too small: {}",
+      _ntp,
       search_start);
-    auto delta = std::prev(interval_end_it)->second.next_delta;
+    auto delta = _next_deltas[interval_end - 1];
 
-    while (interval_end_it != _last_offset2batch.end()) {
+    while (interval_end != end_index()) {
         model::offset max_do_this_interval
-          = model::prev_offset(interval_end_it->second.base_offset)
+          = model::prev_offset(_base_offsets[interval_end])
             - model::offset{delta};
         if (max_do_this_interval >= data_offset) {
             break;
         }
 
-        delta = interval_end_it->second.next_delta;
-        ++interval_end_it;
+        delta = _next_deltas[interval_end];
+        ++interval_end;
     }
 
     return data_offset + model::offset(delta);
 }
 
 int64_t offset_translator_state::last_delta() const {
-    vassert(
-      !_last_offset2batch.empty(),
-      "ntp {}: offsets map shouldn't be empty",
-      _ntp);
+    vassert(!empty(), "ntp {}: offsets map shouldn't be empty", _ntp);
 
-    return _last_offset2batch.rbegin()->second.next_delta;
+    return _next_deltas.back();
 }
 
 model::offset offset_translator_state::last_gap_offset() const {
-    vassert(
-      !_last_offset2batch.empty(),
-      "ntp {}: offsets map shouldn't be empty",
-      _ntp);
+    vassert(!empty(), "ntp {}: offsets map shouldn't be empty", _ntp);
 
-    return _last_offset2batch.rbegin()->first;
+    return _last_offsets.back();
 }
 
 void offset_translator_state::add_gap(
   model::offset base_offset, model::offset last_offset) {
-    vassert(
-      !_last_offset2batch.empty(),
-      "ntp {}: offsets map shouldn't be empty",
-      _ntp);
+    vassert(!empty(), "ntp {}: offsets map shouldn't be empty", _ntp);
 
-    if (last_offset < _last_offset2batch.begin()->first) {
+    if (last_offset < first_last_offset()) {
         // The gap is added before the
         vlog(
           stlog.error,
@@ -167,18 +211,17 @@ void offset_translator_state::add_gap(
           _ntp,
           base_offset,
           last_offset,
-          _last_offset2batch.begin()->first);
+          first_last_offset());
         return;
     }
-    auto rbegin = _last_offset2batch.rbegin();
     int64_t length = last_offset() - base_offset() + 1;
-    int64_t next_delta = rbegin->second.next_delta + length;
+    int64_t next_delta = _next_deltas.back() + length;
 
-    if (base_offset <= rbegin->first) {
-        auto it = _last_offset2batch.find(last_offset);
+    if (base_offset <= _last_offsets.back()) {
+        auto i = lower_bound(last_offset);
         if (
-          it == _last_offset2batch.end()
-          || it->second.base_offset != base_offset) {
+          i == end_index() || _last_offsets[i] != last_offset
+          || _base_offsets[i] != base_offset) {
             // If the gap is added second time it should match
             // the existing one.
             throw std::runtime_error(fmt_with_ctx(
@@ -188,8 +231,8 @@ void offset_translator_state::add_gap(
               _ntp,
               base_offset,
               last_offset,
-              rbegin->second.base_offset,
-              rbegin->second.next_delta));
+              _base_offsets.back(),
+              _next_deltas.back()));
         }
         return;
     }
@@ -200,9 +243,7 @@ void offset_translator_state::add_gap(
       base_offset,
       last_offset,
       next_delta);
-    _last_offset2batch.emplace(
-      last_offset,
-      batch_info{.base_offset = base_offset, .next_delta = next_delta});
+    push_back(last_offset, base_offset, next_delta);
 }
 
 bool offset_translator_state::add_absolute_delta(
@@ -218,12 +259,12 @@ bool offset_translator_state::add_absolute_delta(
     // Remove all overlapping elements
     auto gap_end = model::prev_offset(offset);
     auto gap_length = delta;
-    auto it = _last_offset2batch.upper_bound(gap_end);
+    auto i = upper_bound(gap_end);
     // Add new element if empty or delta is different
     model::offset gap_begin = offset - model::offset(delta);
-    if (it != _last_offset2batch.begin()) {
-        auto back_it = std::prev(it);
-        gap_length -= back_it->second.next_delta;
+    if (i != begin_index()) {
+        auto back = i - 1;
+        gap_length -= _next_deltas[back];
         gap_begin = offset - model::offset(gap_length);
         if (gap_length < 0) {
             // gap is inconsistent and will overlap with the previous
@@ -236,53 +277,54 @@ bool offset_translator_state::add_absolute_delta(
               _ntp,
               offset,
               delta,
-              back_it->first,
-              back_it->second.next_delta,
-              back_it->second.base_offset,
+              _last_offsets[back],
+              _next_deltas[back],
+              _base_offsets[back],
               gap_length));
         }
     }
-    _last_offset2batch.erase(it, _last_offset2batch.end());
-    if (gap_length > 0 || _last_offset2batch.empty()) {
-        _last_offset2batch.emplace(
-          gap_end, batch_info{.base_offset = gap_begin, .next_delta = delta});
+    erase_from(i);
+    if (gap_length > 0 || empty()) {
+        push_back(gap_end, gap_begin, delta);
         return true;
     }
     return false;
 }
 
-void offset_translator_state::reset() { _last_offset2batch.clear(); }
+void offset_translator_state::reset() {
+    _last_offsets.clear();
+    _base_offsets.clear();
+    _next_deltas.clear();
+    _head = 0;
+}
 
 bool offset_translator_state::truncate(model::offset offset) {
-    vassert(
-      !_last_offset2batch.empty(),
-      "ntp {}: offsets map shouldn't be empty",
-      _ntp);
+    vassert(!empty(), "ntp {}: offsets map shouldn't be empty", _ntp);
 
-    auto it = _last_offset2batch.lower_bound(offset);
-    if (it == _last_offset2batch.begin()) {
+    auto i = lower_bound(offset);
+    if (i == begin_index()) {
         throw std::runtime_error{fmt::format(
           "ntp {}: trying to truncate offset_translator at offset {} which "
           "is "
           "<= base translation offset {}",
           _ntp,
           offset,
-          _last_offset2batch.begin()->first)};
+          first_last_offset())};
     }
 
-    if (it != _last_offset2batch.end()) {
-        if (offset > it->second.base_offset) {
+    if (i != end_index()) {
+        if (offset > _base_offsets[i]) {
             throw std::runtime_error{fmt::format(
               "ntp {}: trying to truncate offset_translator at offset {} "
               "which "
               "is in the middle of the batch [{},{}]",
               _ntp,
               offset,
-              it->second.base_offset,
-              it->first)};
+              _base_offsets[i],
+              _last_offsets[i])};
         }
 
-        _last_offset2batch.erase(it, _last_offset2batch.end());
+        erase_from(i);
         return true;
     }
 
@@ -290,39 +332,48 @@ bool offset_translator_state::truncate(model::offset offset) {
 }
 
 bool offset_translator_state::prefix_truncate(model::offset offset) {
-    vassert(
-      !_last_offset2batch.empty(),
-      "ntp {}: offsets map shouldn't be empty",
-      _ntp);
+    vassert(!empty(), "ntp {}: offsets map shouldn't be empty", _ntp);
 
-    auto it = _last_offset2batch.upper_bound(offset);
-    if (it != _last_offset2batch.end() && offset >= it->second.base_offset) {
+    auto i = upper_bound(offset);
+    if (i != end_index() && offset >= _base_offsets[i]) {
         throw std::runtime_error{fmt::format(
           "ntp {}: trying to prefix truncate offset translator at offset "
           "{} "
           "which is in the middle of the batch {}-{}",
           _ntp,
           offset,
-          it->second.base_offset,
-          it->first)};
+          _base_offsets[i],
+          _last_offsets[i])};
     }
 
-    if (it == _last_offset2batch.begin()) {
+    if (i == begin_index()) {
         return false;
     }
 
-    auto prev_it = std::prev(it);
-    if (prev_it == _last_offset2batch.begin() && prev_it->first == offset) {
+    auto prev = i - 1;
+    if (prev == begin_index() && _last_offsets[prev] == offset) {
         return false;
     }
 
-    auto base_batch = prev_it->second;
-    base_batch.base_offset = offset;
-    _last_offset2batch.erase(_last_offset2batch.begin(), it);
-    _last_offset2batch.emplace(offset, base_batch);
+    // the entry before `i` becomes the new base entry, keeping its delta
+    _last_offsets[prev] = offset;
+    _base_offsets[prev] = offset;
+    erase_to(prev);
     return true;
 }
 
+std::vector<offset_translator_state::gap>
+offset_translator_state::gaps_after(model::offset offset) const {
+    std::vector<gap> gaps;
+    auto i = std::max(upper_bound(offset), begin_index() + 1);
+    gaps.reserve(end_index() - std::min(i, end_index()));
+    for (; i < end_index(); ++i) {
+        gaps.push_back(gap{
+          .base_offset = _base_offsets[i], .last_offset = _last_offsets[i]});
+    }
+    return gaps;
+}
+
 namespace {
 
 struct persisted_batch {
@@ -353,21 +404,18 @@ struct persisted_batches_map
 } // namespace
 
 iobuf offset_translator_state::serialize_map() const {
-    vassert(
-      !_last_offset2batch.empty(),
-      "ntp {}: offsets map shouldn't be empty",
-      _ntp);
+    vassert(!empty(), "ntp {}: offsets map shouldn't be empty", _ntp);
 
     std::vector<persisted_batch> batches;
-    batches.reserve(_last_offset2batch.size());
-    for (const auto& [o, b] : _last_offset2batch) {
-        int32_t length = int32_t(o - b.base_offset) + 1;
+    batches.reserve(size());
+    for (auto i = begin_index(); i < end_index(); ++i) {
+        int32_t length = int32_t(_last_offsets[i] - _base_offsets[i]) + 1;
         batches.push_back(
-          persisted_batch{.base_offset = b.base_offset, .length = length});
+          persisted_batch{.base_offset = _base_offsets[i], .length = length});
     }
 
     persisted_batches_map persisted{
-      .start_delta = _last_offset2batch.begin()->second.next_delta,
+      .start_delta = _next_deltas[_head],
       .batches = std::move(batches),
     };
 
@@ -382,7 +430,7 @@ offset_translator_state::from_serialized_map(model::ntp ntp, iobuf buf) {
           "ntp {}: persisted offset translator map shouldn't be empty", ntp)};
     }
 
-    absl::btree_map<model::offset, batch_info> last_offset2batch;
+    offset_translator_state state(std::move(ntp));
     int64_t cur_delta = persisted.start_delta;
     model::offset prev_last_offset;
     for (auto it = persisted.batches.begin(); it != persisted.batches.end();
@@ -393,7 +441,7 @@ offset_translator_state::from_serialized_map(model::ntp ntp, iobuf buf) {
                 throw std::runtime_error{fmt::format(
                   "ntp {}: inconsistency in serialized offset translator "
                   "state: offset {} is after {}",
-                  ntp,
+                  state._ntp,
                   b.base_offset,
                   prev_last_offset)};
             }
@@ -401,14 +449,10 @@ offset_translator_state::from_serialized_map(model::ntp ntp, iobuf buf) {
         }
 
         model::offset last_offset = b.base_offset + model::offset{b.length - 1};
-        last_offset2batch.emplace(
-          last_offset,
-          batch_info{.base_offset = b.base_offset, .next_delta = cur_delta});
+        state.push_back(last_offset, b.base_offset, cur_delta);
         prev_last_offset = last_offset;
     }
 
-    offset_translator_state state(std::move(ntp));
-    state._last_offset2batch = std::move(last_offset2batch);
     return state;
 }
 
@@ -416,23 +460,21 @@ offset_translator_state offset_translator_state::from_bootstrap_state(
   model::ntp ntp, const absl::btree_map<model::offset, int64_t>& offset2delta) {
     offset_translator_state state(std::move(ntp));
     for (const auto& [o, d] : offset2delta) {
-        state._last_offset2batch.emplace(
-          o, batch_info{.base_offset = o, .next_delta = d});
+        state.push_back(o, o, d);
     }
     return state;
 }
 
 std::ostream&
 operator<<(std::ostream& os, const offset_translator_state& state) {
-    const auto& map = state._last_offset2batch;
-
-    if (map.empty()) {
+    if (state.empty()) {
         return os << "{empty}";
     }
 
-    return os << "{base offset/delta: " << map.begin()->first << "/"
-              << map.begin()->second.next_delta << ", map size: " << map.size()
-              << ", last delta: " << map.rbegin()->second.next_delta << "}";
+    return os << "{base offset/delta: " << state.first_last_offset() << "/"
+              << state._next_deltas[state._head]
+              << ", map size: " << state.size()
+              << ", last delta: " << state._next_deltas.back() << "}";
 }
 
 } // namespace storage
@@ -13,9 +13,12 @@
 
 #include "model/fundamental.h"
 #include "serde/serde.h"
+#include "utils/fragmented_vector.h"
 
 #include <absl/container/btree_map.h>
 
+#include <vector>
+
 namespace storage {
 
 /// Provides offset translation between raw log offsets and offsets not counting
@@ -28,6 +31,11 @@ namespace storage {
 /// It works by maintaining an in-memory map of all filtered batch offsets.
 /// This map allows us to quickly find a delta between the raw log offset and
 /// corresponding translated offset.
+///
+/// The map is stored column-wise in offset order: filtered batches are only
+/// ever appended at the end or truncated at either end, so sorted arrays
+/// give O(log n) lookups in both directions without the per-node overhead of
+/// a tree, and lookups only touch the column of last offsets.
 class offset_translator_state {
 public:
     /// Create an empty translator - the delta between log and kafka offsets is
@@ -40,9 +48,7 @@ public:
     offset_translator_state(
       model::ntp ntp, model::offset base_offset, int64_t base_delta)
       : _ntp(std::move(ntp)) {
-        _last_offset2batch.emplace(
-          base_offset,
-          batch_info{.base_offset = base_offset, .next_delta = base_delta});
+        push_back(base_offset, base_offset, base_delta);
     }
 
     offset_translator_state(const offset_translator_state&) = delete;
@@ -52,7 +58,11 @@ public:
 
     const model::ntp& ntp() const { return _ntp; }
 
-    bool empty() const { return _last_offset2batch.empty(); }
+    bool empty() const { return size() == 0; }
+
+    /// Number of filtered batches tracked, including the entry that stands
+    /// in for everything before the start of the translation range.
+    size_t size() const { return _last_offsets.size() - _head; }
 
     /// Difference between the log offset and the kafka offset.
     int64_t delta(model::offset) const;
@@ -92,6 +102,16 @@ public:
     /// changed.
     bool prefix_truncate(model::offset);
 
+    /// A filtered batch, as passed to add_gap().
+    struct gap {
+        model::offset base_offset;
+        model::offset last_offset;
+    };
+
+    /// Filtered batches ending after `offset`, in offset order. Replaying them
+    /// with add_gap() on a state that ends at `offset` reproduces this state.
+    std::vector<gap> gaps_after(model::offset offset) const;
+
     iobuf serialize_map() const;
     static offset_translator_state
     from_serialized_map(model::ntp ntp, iobuf buf);
@@ -105,29 +125,44 @@ public:
     operator<<(std::ostream&, const offset_translator_state&);
 
 private:
-    // Represents a non-data batch in the log - a batch that contributes to the
-    // difference (aka delta) between log (redpanda) and data (kafka) offset.
-    struct batch_info {
-        model::offset base_offset;
-        // The difference between log and data offsets that we want to find by
-        // querying the offset translator. `next_delta` of a _last_offset2batch
-        // map element is active for log offsets in the interval (last offset;
-        // next last offset] (left end exclusive, right end inclusive).
-        int64_t next_delta;
-    };
-
-    // Map from the last offset of non-data batches to the corresponding batch
-    // info.
+    // The columns below describe non-data batches in the log - batches that
+    // contribute to the difference (aka delta) between log (redpanda) and data
+    // (kafka) offset. Entry i covers the batch [_base_offsets[i],
+    // _last_offsets[i]]; _next_deltas[i] is the difference between log and
+    // data offsets that we want to find by querying the offset translator,
+    // active for log offsets in the interval (_last_offsets[i];
+    // _last_offsets[i + 1]] (left end exclusive, right end inclusive).
+    //
+    // As prefix truncations happen, we drop entries with last offsets less
+    // than log_start and substitute them with a single entry with the last
+    // offset prev_offset(log_start) and next_delta equal to delta(log_start) -
+    // this way we can calculate delta for any offset starting from log_start.
     //
-    // As prefix truncations happen, we remove elements with keys less than
-    // log_start and substitute them with a single element with the key
-    // prev_offset(log_start) and next_delta equal to delta(log_start) - this
-    // way we can calculate delta for any offset starting from log_start.
-    using batches_map_t = absl::btree_map<model::offset, batch_info>;
+    // Entries before _head have been prefix truncated; they are dropped from
+    // the columns in bulk once they make up half of them.
+    size_t begin_index() const { return _head; }
+    size_t end_index() const { return _last_offsets.size(); }
+    size_t lower_bound(model::offset) const;
+    size_t upper_bound(model::offset) const;
+    model::offset first_last_offset() const { return _last_offsets[_head]; }
+
+    void push_back(
+      model::offset last_offset, model::offset base_offset, int64_t delta);
+    // Drops entries starting at index `i`.
+    void erase_from(size_t i);
+    // Drops entries before index `i`.
+    void erase_to(size_t i);
 
 private:
+    // Small fragments: most partitions only ever track a handful of batches.
+    template<typename T>
+    using column_t = fragmented_vector<T, 1024>;
+
     model::ntp _ntp;
-    batches_map_t _last_offset2batch;
+    column_t<model::offset> _last_offsets;
+    column_t<model::offset> _base_offsets;
+    column_t<int64_t> _next_deltas;
+    size_t _head{0};
 };
 
 } // namespace storage
@@ -151,3 +151,59 @@ SEASTAR_THREAD_TEST_CASE(offset_translator_state_case_2) {
     BOOST_REQUIRE_EQUAL(state.last_delta(), 10_do);
     BOOST_REQUIRE_EQUAL(state.last_gap_offset(), 100_rp);
 }
+
+SEASTAR_THREAD_TEST_CASE(offset_translator_state_prefix_truncate_repeatedly) {
+    storage::offset_translator_state state(ntp, model::offset::min(), 0);
+    // a gap at every 10th offset, so log offset o has o / 10 + 1 gaps before
+    // or at it
+    for (int64_t o = 0; o < 1000; o += 10) {
+        state.add_gap(model::offset(o), model::offset(o));
+    }
+    BOOST_REQUIRE_EQUAL(state.size(), 101);
+
+    // prefix truncations drop entries in bulk behind the scenes, translation
+    // has to stay the same throughout
+    for (int64_t start = 5; start < 1000; start += 10) {
+        BOOST_REQUIRE(state.prefix_truncate(model::offset(start)));
+        BOOST_REQUIRE_EQUAL(state.size(), (1000 - start) / 10 + 1);
+        for (int64_t o = start + 1; o < 1000; ++o) {
+            if (o % 10 == 0) {
+                continue;
+            }
+            auto kafka = model::offset(o - (o / 10 + 1));
+            BOOST_REQUIRE_EQUAL(state.from_log_offset(model::offset(o)), kafka);
+            BOOST_REQUIRE_EQUAL(state.to_log_offset(kafka), model::offset(o));
+        }
+    }
+    BOOST_REQUIRE_EQUAL(state.last_gap_offset(), 995_rp);
+    BOOST_REQUIRE_EQUAL(state.last_delta(), 100);
+}
+
+SEASTAR_THREAD_TEST_CASE(offset_translator_state_gaps_after) {
+    storage::offset_translator_state state(ntp, 9_rp, 0);
+    state.add_gap(10_rp, 14_rp);
+    state.add_gap(18_rp, 19_rp);
+    state.add_gap(25_rp, 28_rp);
+
+    auto gaps = state.gaps_after(14_rp);
+    BOOST_REQUIRE_EQUAL(gaps.size(), 2);
+    BOOST_REQUIRE_EQUAL(gaps[0].base_offset, 18_rp);
+    BOOST_REQUIRE_EQUAL(gaps[1].last_offset, 28_rp);
+
+    // the base entry isn't a gap of its own
+    BOOST_REQUIRE_EQUAL(state.gaps_after(model::offset::min()).size(), 3);
+    BOOST_REQUIRE(state.gaps_after(28_rp).empty());
+
+    // replaying the gaps onto a truncated copy reproduces the state
+    auto copy = storage::offset_translator_state::from_serialized_map(
+      ntp, state.serialize_map());
+    BOOST_REQUIRE(copy.truncate(18_rp));
+    for (const auto& g : gaps) {
+        copy.add_gap(g.base_offset, g.last_offset);
+    }
+    BOOST_REQUIRE_EQUAL(copy.size(), state.size());
+    BOOST_REQUIRE_EQUAL(copy.last_delta(), state.last_delta());
+    for (auto o = 10_rp; o <= 30_rp; ++o) {
+        BOOST_REQUIRE_EQUAL(copy.delta(o), state.delta(o));
+    }
+}
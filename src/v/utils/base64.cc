@@ -10,14 +10,17 @@
  */
 #include "utils/base64.h"
 
+#include "units.h"
 #include "vassert.h"
 
 #include <seastar/core/sstring.hh>
 
 #include <libbase64.h>
 
+#include <array>
+
 // Required length is ceil(4n/3) rounded up to 4 bytes
-static inline size_t encode_capacity(size_t input_size) {
+static constexpr size_t encode_capacity(size_t input_size) {
     return (((4 * input_size) / 3) + 3) & ~0x3U;
 }
 
@@ -110,3 +113,34 @@ ss::sstring iobuf_to_base64(const iobuf& input) {
     output.resize(written);
     return output;
 }
+
+iobuf iobuf_to_base64_chunked(const iobuf& input) {
+    // The stream encoder carries up to 2 bytes of input between calls
+    static constexpr size_t chunk_size = 3_KiB;
+    std::array<char, encode_capacity(chunk_size + 2)> output_chunk{};
+    iobuf output;
+
+    base64_state state; // NOLINT
+    base64_stream_encode_init(&state, 0);
+
+    iobuf::iterator_consumer input_it(input.cbegin(), input.cend());
+    input_it.consume(
+      input.size_bytes(),
+      [&state, &output, &output_chunk](const char* src, size_t sz) {
+          while (sz > 0) {
+              auto n = std::min(sz, chunk_size);
+              size_t output_len; // NOLINT
+              base64_stream_encode(
+                &state, src, n, output_chunk.data(), &output_len);
+              output.append(output_chunk.data(), output_len);
+              src += n; // NOLINT
+              sz -= n;
+          }
+          return ss::stop_iteration::no;
+      });
+
+    size_t output_len; // NOLINT
+    base64_stream_encode_final(&state, output_chunk.data(), &output_len);
+    output.append(output_chunk.data(), output_len);
+    return output;
+}
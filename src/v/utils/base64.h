@@ -31,3 +31,7 @@ ss::sstring base64_to_string(std::string_view);
 
 // base64 <-> iobuf
 ss::sstring iobuf_to_base64(const iobuf&);
+
+// iobuf -> base64, encoded in small chunks rather than into one contiguous
+// string
+iobuf iobuf_to_base64_chunked(const iobuf&);
@@ -22,13 +22,17 @@
 
 static ss::logger logger{"request_auth"};
 
+// Users per shard whose verified password is remembered
+static constexpr size_t verified_passwords_capacity = 1024;
+
 request_authenticator::request_authenticator(
   config::binding<bool> require_auth,
   config::binding<std::vector<ss::sstring>> superusers,
   cluster::controller* controller)
   : _controller(controller)
   , _require_auth(std::move(require_auth))
-  , _superusers(std::move(superusers)) {}
+  , _superusers(std::move(superusers))
+  , _verified_passwords(verified_passwords_capacity) {}
 
 /**
  * Attempt to authenticate the request.
@@ -115,24 +119,8 @@ request_auth_result request_authenticator::do_authenticate(
               "Unauthorized", ss::http::reply::status_type::unauthorized);
         } else {
             const auto& cred = cred_opt.value();
-            ss::sstring sasl_mechanism;
-            bool is_valid{false};
-            if (security::scram_sha256::validate_password(
-                  password,
-                  cred.stored_key(),
-                  cred.salt(),
-                  cred.iterations())) {
-                is_valid = true;
-                sasl_mechanism = security::scram_sha256_authenticator::name;
-            } else if (security::scram_sha512::validate_password(
-                         password,
-                         cred.stored_key(),
-                         cred.salt(),
-                         cred.iterations())) {
-                is_valid = true;
-                sasl_mechanism = security::scram_sha512_authenticator::name;
-            }
-            if (!is_valid) {
+            auto sasl_mechanism = validate_password(username, password, cred);
+            if (sasl_mechanism.empty()) {
                 // User found, password doesn't match
                 vlog(
                   logger.warn,
@@ -170,6 +158,34 @@ request_auth_result request_authenticator::do_authenticate(
     }
 }
 
+/**
+ * Verify the password against the user's stored credential.
+ *
+ * @return the SASL mechanism of the credential, or empty if the password
+ * doesn't match
+ */
+ss::sstring request_authenticator::validate_password(
+  const security::credential_user& username,
+  const security::credential_password& password,
+  const security::scram_credential& cred) {
+    if (auto mechanism = _verified_passwords.find(username, password, cred)) {
+        return std::move(*mechanism);
+    }
+
+    ss::sstring sasl_mechanism;
+    if (security::scram_sha256::validate_password(
+          password, cred.stored_key(), cred.salt(), cred.iterations())) {
+        sasl_mechanism = security::scram_sha256_authenticator::name;
+    } else if (security::scram_sha512::validate_password(
+                 password, cred.stored_key(), cred.salt(), cred.iterations())) {
+        sasl_mechanism = security::scram_sha512_authenticator::name;
+    }
+    if (!sasl_mechanism.empty()) {
+        _verified_passwords.insert(username, password, cred, sasl_mechanism);
+    }
+    return sasl_mechanism;
+}
+
 void request_auth_result::require_superuser() {
     _checked = true;
     if (!_superuser) {
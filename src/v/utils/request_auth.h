@@ -14,6 +14,7 @@
 #include "cluster/fwd.h"
 #include "config/property.h"
 #include "security/fwd.h"
+#include "security/scram_password_cache.h"
 #include "security/types.h"
 
 #include <seastar/http/request.hh>
@@ -105,7 +106,13 @@ private:
       security::credential_store const& cred_store,
       bool require_auth);
 
+    ss::sstring validate_password(
+      const security::credential_user& username,
+      const security::credential_password& password,
+      const security::scram_credential& cred);
+
     cluster::controller* _controller{nullptr};
     config::binding<bool> _require_auth;
     config::binding<std::vector<ss::sstring>> _superusers;
+    security::scram_password_cache _verified_passwords;
 };
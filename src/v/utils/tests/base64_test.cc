@@ -7,6 +7,7 @@
 // the Business Source License, use of this software will be governed
 // by the Apache License, Version 2.0
 
+#include "bytes/iobuf_parser.h"
 #include "random/generators.h"
 #include "utils/base64.h"
 
@@ -48,3 +49,24 @@ BOOST_AUTO_TEST_CASE(iobuf_type) {
     auto decoded = base64_to_bytes(encoded);
     BOOST_REQUIRE_EQUAL(decoded, iobuf_to_bytes(buf));
 }
+
+BOOST_AUTO_TEST_CASE(iobuf_type_chunked) {
+    auto to_string = [](const iobuf& buf) {
+        iobuf_parser p(buf.copy());
+        return p.read_string(p.bytes_left());
+    };
+
+    BOOST_REQUIRE_EQUAL(to_string(iobuf_to_base64_chunked(iobuf{})), "");
+    BOOST_REQUIRE_EQUAL(
+      to_string(iobuf_to_base64_chunked(bytes_to_iobuf("a"))), "YQ==");
+
+    // fragments of sizes that aren't a multiple of 3, spanning several
+    // encoder chunks
+    iobuf buf;
+    for (auto sz : {1, 127, 5000, 2, 10000}) {
+        auto data = random_generators::get_bytes(sz);
+        buf.append(data.data(), data.size());
+    }
+    BOOST_REQUIRE_EQUAL(
+      to_string(iobuf_to_base64_chunked(buf)), iobuf_to_base64(buf));
+}